@@ -3,7 +3,9 @@
 ///////////////////////////////////////////////////////////////////////////////
 #define MINIAUDIO_IMPLEMENTATION
 #include "Arcade/audio/Audio.hpp"
+#include "Arcade/core/AllocationTracker.hpp"
 #include <algorithm>
+#include <fstream>
 #include <iostream>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19,7 +21,7 @@ std::unordered_map<
     std::string, std::shared_ptr<Audio::AudioSource>
 > Audio::mSources;
 std::array<Audio::Sound, Audio::MAX_SOUNDS> Audio::mSoundPool;
-size_t Audio::mActiveSounds = 0;
+std::atomic<size_t> Audio::mActiveSounds(0);
 ma_device Audio::mDevice = {};
 std::mutex Audio::mMutex;
 std::atomic<bool> Audio::mInitialized(false);
@@ -43,7 +45,7 @@ bool Audio::Initialize(void)
     deviceConfig.sampleRate = 48000;
     deviceConfig.dataCallback = DataCallback;
     deviceConfig.pUserData = nullptr;
-    deviceConfig.periodSizeInFrames = 1024;
+    deviceConfig.periodSizeInFrames = BLOCK_FRAMES;
 
     mOutputFormat = deviceConfig.playback.format;
     mOutputChannels = deviceConfig.playback.channels;
@@ -54,7 +56,12 @@ bool Audio::Initialize(void)
         return (false);
     }
 
-    mMixBuffer.resize(mOutputChannels * 8192);
+    // Sized before the callback can run, Play only grows the scratch
+    // buffers of the sources with more channels than the device
+    mMixBuffer.assign(BLOCK_FRAMES * mOutputChannels, 0.0f);
+    for (auto& sound : mSoundPool) {
+        sound.scratch.resize(BLOCK_FRAMES * mOutputChannels);
+    }
 
     result = ma_device_start(&mDevice);
     if (result != MA_SUCCESS) {
@@ -77,9 +84,7 @@ void Audio::DataCallback(
     (void)pDevice;
     (void)pInput;
 
-    if (!mInitialized) {
-        return;
-    }
+    AllocationTracker::Scope scope(AllocationTracker::Phase::AUDIO);
 
     float* outputBuffer = static_cast<float*>(pOutput);
     std::fill(
@@ -88,15 +93,21 @@ void Audio::DataCallback(
         0.0f
     );
 
-    std::unique_lock<std::mutex> lock(mMutex, std::try_to_lock);
-    if (!lock.owns_lock() || mActiveSounds == 0) {
+    if (!mInitialized || mActiveSounds == 0) {
         return;
     }
 
-    if (mMixBuffer.size() < frameCount * mOutputChannels) {
-        mMixBuffer.resize(frameCount * mOutputChannels);
+    for (ma_uint32 offset = 0; offset < frameCount; offset += BLOCK_FRAMES) {
+        MixBlock(
+            outputBuffer + offset * mOutputChannels,
+            std::min(BLOCK_FRAMES, frameCount - offset)
+        );
     }
+}
 
+///////////////////////////////////////////////////////////////////////////////
+void Audio::MixBlock(float* output, ma_uint32 frameCount)
+{
     std::fill(
         mMixBuffer.begin(),
         mMixBuffer.begin() + frameCount * mOutputChannels,
@@ -104,79 +115,72 @@ void Audio::DataCallback(
     );
 
     for (auto& sound : mSoundPool) {
-        if (sound.status != SoundStatus::PLAYING || !sound.source) {
+        if (sound.status.load(std::memory_order_acquire) !=
+            SoundStatus::PLAYING) {
+            continue;
+        }
+        if (sound.stopRequested.load(std::memory_order_acquire)) {
+            FinishSound(sound);
             continue;
         }
 
-        ma_uint32 decoderChannels = sound.source->decoder.outputChannels;
-
-        std::vector<float> tempBuffer(frameCount * decoderChannels * 2);
-
+        ma_uint32 decoderChannels = sound.decoder.outputChannels;
         ma_uint32 totalFramesProcessed = 0;
 
         while (totalFramesProcessed < frameCount) {
-            ma_uint32 framesToProcess = frameCount - totalFramesProcessed;
             ma_uint64 framesRead = 0;
 
-            ma_result result = ma_decoder_read_pcm_frames(
-                &sound.source->decoder,
-                tempBuffer.data(),
-                framesToProcess,
+            ma_decoder_read_pcm_frames(
+                &sound.decoder,
+                sound.scratch.data(),
+                frameCount - totalFramesProcessed,
                 &framesRead
             );
 
-            if (framesRead == 0 && result != MA_SUCCESS) {
-                sound.status = SoundStatus::STOPPED;
-                break;
-            }
-
-            if (framesRead < framesToProcess) {
-                if (sound.loop) {
-                    ma_decoder_seek_to_pcm_frame(&sound.source->decoder, 0);
-
-                    if (framesRead < framesToProcess) {
-                        ma_uint64 remainingFrames = 0;
-                        ma_decoder_read_pcm_frames(
-                            &sound.source->decoder,
-                            tempBuffer.data() + (framesRead * decoderChannels),
-                            framesToProcess - framesRead,
-                            &remainingFrames
-                        );
-                        framesRead += remainingFrames;
-                    }
-                } else if (framesRead == 0) {
-                    sound.status = SoundStatus::STOPPED;
-                    break;
+            if (framesRead == 0) {
+                // A loop restarts once per empty read, an empty file ends
+                if (
+                    sound.loop && sound.position > 0 &&
+                    ma_decoder_seek_to_pcm_frame(&sound.decoder, 0) ==
+                        MA_SUCCESS
+                ) {
+                    sound.position = 0;
+                    continue;
                 }
+                FinishSound(sound);
+                break;
             }
 
             MixSamplesWithConversion(
                 mMixBuffer.data() + (totalFramesProcessed * mOutputChannels),
-                tempBuffer.data(),
-                framesRead,
+                sound.scratch.data(),
+                static_cast<ma_uint32>(framesRead),
                 decoderChannels,
                 mOutputChannels,
-                sound.volume
+                sound.volume.load(std::memory_order_relaxed)
             );
 
-            totalFramesProcessed += framesRead;
+            totalFramesProcessed += static_cast<ma_uint32>(framesRead);
             sound.position += framesRead;
-
-            if (framesRead < framesToProcess && !sound.loop) {
-                break;
-            }
         }
     }
 
     ApplyLimiter(mMixBuffer.data(), frameCount * mOutputChannels);
 
     memcpy(
-        pOutput,
+        output,
         mMixBuffer.data(),
         frameCount * mOutputChannels * sizeof(float)
     );
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void Audio::FinishSound(Sound& sound)
+{
+    sound.status.store(SoundStatus::STOPPED, std::memory_order_release);
+    mActiveSounds--;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 void Audio::MixSamplesWithConversion(
     float* output,
@@ -257,6 +261,8 @@ std::string Audio::Play(
 
     std::lock_guard<std::mutex> lock(mMutex);
 
+    ReclaimSounds();
+
     size_t slotIndex = FindAvailableSlot();
     if (slotIndex >= MAX_SOUNDS) {
         return ("");
@@ -267,41 +273,47 @@ std::string Audio::Play(
 
     if (sourceIt != mSources.end()) {
         source = sourceIt->second;
-        source->refCount++;
     } else {
-        source = std::make_shared<AudioSource>();
-        source->path = path;
-
-        ma_decoder_config decoderConfig = ma_decoder_config_init(
-            ma_format_f32, 0, 0
-        );
-        ma_result result = ma_decoder_init_file(
-            path.c_str(), &decoderConfig, &source->decoder
-        );
-        if (result != MA_SUCCESS) {
+        source = LoadSource(path);
+        if (!source) {
             return ("");
         }
-        source->refCount = 1;
         mSources[path] = source;
     }
 
-    for (auto& sound : mSoundPool) {
-        if (sound.id == soundId && sound.status == SoundStatus::PLAYING) {
-            sound.status = SoundStatus::STOPPED;
+    Sound& sound = mSoundPool[slotIndex];
+
+    if (!InitDecoder(*source, sound.decoder)) {
+        return ("");
+    }
+    source->refCount++;
+
+    for (auto& other : mSoundPool) {
+        if (
+            other.id == soundId &&
+            other.status.load(std::memory_order_acquire) ==
+                SoundStatus::PLAYING
+        ) {
+            other.stopRequested.store(true, std::memory_order_release);
         }
     }
 
-    Sound& sound = mSoundPool[slotIndex];
+    size_t samples = BLOCK_FRAMES * sound.decoder.outputChannels;
+
+    if (sound.scratch.size() < samples) {
+        sound.scratch.resize(samples);
+    }
     sound.id = soundId;
     sound.source = source;
+    sound.hasDecoder = true;
     sound.position = 0;
     sound.volume = std::max(0.0f, std::min(1.0f, volume));
     sound.loop = loop;
-    sound.status = SoundStatus::PLAYING;
-
-    ma_decoder_seek_to_pcm_frame(&sound.source->decoder, 0);
+    sound.stopRequested = false;
 
+    // Counted first, the callback may finish the sound right away
     mActiveSounds++;
+    sound.status.store(SoundStatus::PLAYING, std::memory_order_release);
 
     return (soundId);
 }
@@ -316,23 +328,16 @@ void Audio::Stop(const std::string& id)
     std::lock_guard<std::mutex> lock(mMutex);
 
     for (auto& sound : mSoundPool) {
-        if (sound.id == id && sound.status == SoundStatus::PLAYING) {
-            sound.status = SoundStatus::STOPPED;
-            mActiveSounds--;
-            if (sound.source) {
-                auto sourceIt = mSources.find(sound.source->path);
-                if (sourceIt != mSources.end()) {
-                    sourceIt->second->refCount--;
-                    if (sourceIt->second->refCount <= 0) {
-                        ma_decoder_uninit(&sourceIt->second->decoder);
-                        mSources.erase(sourceIt);
-                    }
-                }
-                sound.source = nullptr;
-            }
+        if (
+            sound.id == id &&
+            sound.status.load(std::memory_order_acquire) ==
+                SoundStatus::PLAYING
+        ) {
+            sound.stopRequested.store(true, std::memory_order_release);
             break;
         }
     }
+    ReclaimSounds();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -345,29 +350,28 @@ void Audio::StopAll(void)
     std::lock_guard<std::mutex> lock(mMutex);
 
     for (auto& sound : mSoundPool) {
-        if (sound.status == SoundStatus::PLAYING) {
-            sound.status = SoundStatus::STOPPED;
-            if (sound.source) {
-                auto sourceIt = mSources.find(sound.source->path);
-                if (sourceIt != mSources.end()) {
-                    sourceIt->second->refCount--;
-                }
-                sound.source = nullptr;
-            }
+        if (sound.status.load(std::memory_order_acquire) ==
+            SoundStatus::PLAYING) {
+            sound.stopRequested.store(true, std::memory_order_release);
         }
     }
+    ReclaimSounds();
 
+    // The sounds still playing keep their source alive until released
     auto it = mSources.begin();
     while (it != mSources.end()) {
         if (it->second->refCount <= 0) {
-            ma_decoder_uninit(&it->second->decoder);
             it = mSources.erase(it);
         } else {
             ++it;
         }
     }
+}
 
-    mActiveSounds = 0;
+///////////////////////////////////////////////////////////////////////////////
+size_t Audio::GetActiveCount(void)
+{
+    return (mActiveSounds.load(std::memory_order_relaxed));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -380,8 +384,15 @@ void Audio::SetVolume(const std::string& id, float volume)
     std::lock_guard<std::mutex> lock(mMutex);
 
     for (auto& sound : mSoundPool) {
-        if (sound.id == id && sound.status == SoundStatus::PLAYING) {
-            sound.volume = std::max(0.0f, std::min(1.0f, volume));
+        if (
+            sound.id == id &&
+            sound.status.load(std::memory_order_acquire) ==
+                SoundStatus::PLAYING
+        ) {
+            sound.volume.store(
+                std::max(0.0f, std::min(1.0f, volume)),
+                std::memory_order_relaxed
+            );
             break;
         }
     }
@@ -400,16 +411,11 @@ bool Audio::Preload(const std::string& path)
         return (true);
     }
 
-    auto source = std::make_shared<AudioSource>();
-    source->path = path;
-    ma_result result = ma_decoder_init_file(
-        path.c_str(), NULL, &source->decoder
-    );
-    if (result != MA_SUCCESS) {
+    std::shared_ptr<AudioSource> source = LoadSource(path);
+    if (!source) {
         return (false);
     }
 
-    source->refCount = 0;
     mSources[path] = source;
 
     return (true);
@@ -424,9 +430,10 @@ void Audio::ReleaseFromCache(const std::string& path)
 
     std::lock_guard<std::mutex> lock(mMutex);
 
+    ReclaimSounds();
+
     auto sourceIt = mSources.find(path);
     if (sourceIt != mSources.end() && sourceIt->second->refCount <= 0) {
-        ma_decoder_uninit(&sourceIt->second->decoder);
         mSources.erase(sourceIt);
     }
 }
@@ -438,32 +445,100 @@ void Audio::Shutdown(void)
         return;
     }
 
-    StopAll();
-
+    // Once the device is stopped, every sound belongs to this thread
     ma_device_uninit(&mDevice);
     mInitialized = false;
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    for (auto& sound : mSoundPool) {
+        sound.status.store(SoundStatus::STOPPED, std::memory_order_relaxed);
+    }
+    ReclaimSounds();
+    mSources.clear();
+    mActiveSounds = 0;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 size_t Audio::FindAvailableSlot(void)
 {
     for (size_t i = 0; i < MAX_SOUNDS; ++i) {
-        if (mSoundPool[i].status == SoundStatus::STOPPED) {
+        if (
+            mSoundPool[i].status.load(std::memory_order_acquire) ==
+                SoundStatus::STOPPED &&
+            !mSoundPool[i].hasDecoder
+        ) {
             return (i);
         }
     }
 
-    if (mActiveSounds >= MAX_SOUNDS) {
-        return (MAX_SOUNDS);
-    }
+    return (MAX_SOUNDS);
+}
 
-    for (size_t i = 0; i < MAX_SOUNDS; ++i) {
-        if (mSoundPool[i].source == nullptr) {
-            return (i);
+///////////////////////////////////////////////////////////////////////////////
+void Audio::ReclaimSounds(void)
+{
+    for (auto& sound : mSoundPool) {
+        if (
+            !sound.hasDecoder ||
+            sound.status.load(std::memory_order_acquire) !=
+                SoundStatus::STOPPED
+        ) {
+            continue;
         }
+
+        ma_decoder_uninit(&sound.decoder);
+        sound.hasDecoder = false;
+        sound.source->refCount--;
+        sound.source = nullptr;
+        sound.id.clear();
     }
+}
 
-    return (MAX_SOUNDS);
+///////////////////////////////////////////////////////////////////////////////
+std::shared_ptr<Audio::AudioSource> Audio::LoadSource(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+
+    if (!file) {
+        return (nullptr);
+    }
+
+    auto source = std::make_shared<AudioSource>();
+    std::streamsize size = file.tellg();
+
+    source->path = path;
+    source->data.resize(static_cast<size_t>(std::max<std::streamsize>(
+        size, 0
+    )));
+    file.seekg(0);
+    if (!file.read(source->data.data(), size)) {
+        return (nullptr);
+    }
+
+    // Checked once here, so that Play only fails on a full pool
+    ma_decoder decoder;
+    if (!InitDecoder(*source, decoder)) {
+        return (nullptr);
+    }
+    ma_decoder_uninit(&decoder);
+
+    return (source);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Audio::InitDecoder(const AudioSource& source, ma_decoder& decoder)
+{
+    ma_decoder_config decoderConfig = ma_decoder_config_init(
+        ma_format_f32, 0, mSampleRate
+    );
+
+    return (ma_decoder_init_memory(
+        source.data.data(),
+        source.data.size(),
+        &decoderConfig,
+        &decoder
+    ) == MA_SUCCESS);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -27,6 +27,16 @@ namespace Arc
 ///////////////////////////////////////////////////////////////////////////////
 /// \brief Audio playback system based on miniaudio with optimized performance
 ///
+/// The mixer callback runs on the real-time audio thread, so it never locks
+/// nor allocates. Each sound owns a decoder over the cached file data and a
+/// scratch buffer of BLOCK_FRAMES frames, both set up by Play before the
+/// sound is handed to the callback, and the callback mixes in blocks of that
+/// size. The callback hands finished or stopped sounds back by setting
+/// their status, and the next call from the main thread releases them.
+///
+/// Built with ARC_DEBUG, an allocation or a mutex lock in the callback
+/// aborts, see AllocationTracker::CheckRealTime.
+///
 ///////////////////////////////////////////////////////////////////////////////
 class Audio
 {
@@ -37,6 +47,12 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     static constexpr size_t MAX_SOUNDS = 32;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Frames mixed at once, the size of the mixing buffers
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr ma_uint32 BLOCK_FRAMES = 1024;
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Sound status
     ///////////////////////////////////////////////////////////////////////////
@@ -59,7 +75,7 @@ private:
         //
         ///////////////////////////////////////////////////////////////////////
         std::string path;           //<! Path to the audio file
-        ma_decoder decoder;         //<! Audio decoder
+        std::vector<char> data;     //<! Encoded file, decoded by each sound
         std::atomic<int> refCount;  //<! Reference counter for cache management
 
     public:
@@ -83,10 +99,14 @@ private:
         ///////////////////////////////////////////////////////////////////////
         std::string id;                         //<! Unique identifier
         std::shared_ptr<AudioSource> source;    //<! Audio source data
+        ma_decoder decoder;                     //<! Own decoder of the source
+        bool hasDecoder;                        //<! Until released
+        std::vector<float> scratch;             //<! Decoded block
         ma_uint64 position;                     //<! Current playback position
-        float volume;                           //<! Playback volume
+        std::atomic<float> volume;              //<! Playback volume
         bool loop;                              //<! Whether to loop the sound
-        SoundStatus status;                     //<! Current status
+        std::atomic<SoundStatus> status;        //<! Playing: callback owned
+        std::atomic<bool> stopRequested;        //<! Asked by Stop
 
     public:
         ///////////////////////////////////////////////////////////////////////
@@ -94,10 +114,13 @@ private:
         ///
         ///////////////////////////////////////////////////////////////////////
         Sound(void)
-            : position(0)
+            : decoder()
+            , hasDecoder(false)
+            , position(0)
             , volume(1.0f)
             , loop(false)
             , status(SoundStatus::STOPPED)
+            , stopRequested(false)
         {}
     };
 
@@ -109,7 +132,7 @@ private:
         std::string, std::shared_ptr<AudioSource>
     > mSources;
     static std::array<Sound, MAX_SOUNDS> mSoundPool;
-    static size_t mActiveSounds;
+    static std::atomic<size_t> mActiveSounds;
     static ma_device mDevice;
     static std::mutex mMutex;
     static std::atomic<bool> mInitialized;
@@ -142,6 +165,49 @@ private:
     ///////////////////////////////////////////////////////////////////////////
     static size_t FindAvailableSlot(void);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Mix the playing sounds, at most BLOCK_FRAMES frames
+    ///
+    /// \param output The interleaved output samples
+    /// \param frameCount The frames to write
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void MixBlock(float* output, ma_uint32 frameCount);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Hand a sound back to the main thread, from the callback
+    ///
+    /// \param sound The sound
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void FinishSound(Sound& sound);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Release the decoders and sources of the finished sounds,
+    /// under mMutex
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void ReclaimSounds(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Read an audio file and check that it decodes
+    ///
+    /// \param path Path to the audio file
+    /// \return The source, nullptr if it cannot be decoded
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static std::shared_ptr<AudioSource> LoadSource(const std::string& path);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Open a decoder over a source, converted for the device
+    ///
+    /// \param source The source
+    /// \param decoder The decoder to initialize
+    /// \return True if the source could be decoded
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static bool InitDecoder(const AudioSource& source, ma_decoder& decoder);
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -233,6 +299,14 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     static void StopAll();
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the number of sounds playing
+    ///
+    /// \return The active voice count, read without locking the mixer
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static size_t GetActiveCount(void);
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Set volume for a specific sound
     ///
@@ -14,10 +14,19 @@ namespace Arc
 {
 
 ///////////////////////////////////////////////////////////////////////////////
-std::unordered_map<API::Event::Channel, std::queue<API::Event>> API::mEvents;
+RingBuffer<API::Event> API::mEvents[API::Event::CHANNEL_COUNT];
 
 ///////////////////////////////////////////////////////////////////////////////
-std::queue<std::tuple<IGameModule::Asset, Vec2f, Color>> API::mDrawables;
+SpriteRegistry API::mSprites;
+
+///////////////////////////////////////////////////////////////////////////////
+DrawBuffer API::mDrawBuffers[2];
+
+///////////////////////////////////////////////////////////////////////////////
+int API::mFrontBuffer = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+TileLayer API::mLayer;
 
 ///////////////////////////////////////////////////////////////////////////////
 int API::mGridWidth;
@@ -25,47 +34,190 @@ int API::mGridWidth;
 ///////////////////////////////////////////////////////////////////////////////
 int API::mGridHeight;
 
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t API::mInputCount = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+StringPool API::mStrings;
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::uint64_t> API::mRandomState{0};
+
 ///////////////////////////////////////////////////////////////////////////////
 std::optional<API::Event> API::PollEvent(API::Event::Channel channel)
 {
-    if (mEvents.count(channel) == 0 || mEvents[channel].empty()) {
+    if (mEvents[channel].IsEmpty()) {
         return (std::nullopt);
     }
-    auto event = mEvents[channel].front();
-    mEvents[channel].pop();
-    return (event);
+    return (mEvents[channel].Pop());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void API::PushEvent(API::Event::Channel channel, Event event)
+{
+    if (event.Is<Event::KeyPressed>() || event.Is<Event::MousePressed>()) {
+        mInputCount++;
+    }
+    mEvents[channel].Push(std::move(event));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t API::GetInputCount(void)
+{
+    return (mInputCount);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t API::GetEventCount(Event::Channel channel)
+{
+    return (mEvents[channel].GetSize());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void API::SetRandomSeed(std::uint64_t seed)
+{
+    mRandomState = seed;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint32_t API::NextRandomSeed(void)
+{
+    // splitmix64, the state only moves by a constant so it can be shared by
+    // the loader threads without a lock
+    std::uint64_t z = mRandomState.fetch_add(0x9e3779b97f4a7c15ull) +
+        0x9e3779b97f4a7c15ull;
+
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return (static_cast<std::uint32_t>((z ^ (z >> 31)) >> 32));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+StringId API::InternString(const std::string& string)
+{
+    return (mStrings.Intern(string));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+StringList API::InternStrings(const std::vector<std::string>& strings)
+{
+    return (mStrings.Intern(strings));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const std::string& API::GetString(StringId id)
+{
+    return (mStrings.Get(id));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::string> API::GetStrings(const StringList& list)
+{
+    return (mStrings.Get(list));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+SpriteHandle API::RegisterSprite(const IGameModule::Asset& asset)
+{
+    return (mSprites.Register(asset));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<SpriteHandle> API::RegisterSprites(
+    const std::vector<IGameModule::Asset>& assets
+)
+{
+    std::vector<SpriteHandle> handles;
+
+    handles.reserve(assets.size());
+    for (const auto& asset : assets) {
+        handles.push_back(mSprites.Register(asset));
+    }
+    return (handles);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Span<const Sprite> API::GetSprites(void)
+{
+    return (mSprites.GetSprites());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void API::PushEvent(API::Event::Channel channel, const Event& event)
+void API::Draw(SpriteHandle sprite, Vec2f position, Color color, int id)
 {
-    mEvents[channel].push(event);
+    mDrawBuffers[1 - mFrontBuffer].Push(sprite, position, color, id);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void API::Draw(SpriteHandle sprite, Vec2i position, Color color, int id)
+{
+    mDrawBuffers[1 - mFrontBuffer].Push(sprite, Vec2f(position), color, id);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void API::Draw(const IGameModule::Asset& drawable, Vec2f position, Color color)
 {
-    mDrawables.push(std::make_tuple(drawable, position, color));
+    Draw(mSprites.Register(drawable), position, color, drawable.id);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void API::Draw(const IGameModule::Asset& drawable, Vec2i position, Color color)
 {
-    mDrawables.push(std::make_tuple(drawable, Vec2f(position), color));
+    Draw(mSprites.Register(drawable), Vec2f(position), color, drawable.id);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Span<const DrawCommand> API::GetDrawCommands(void)
+{
+    return (mDrawBuffers[mFrontBuffer].GetCommands());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void API::SwapDrawBuffers(void)
+{
+    mFrontBuffer = 1 - mFrontBuffer;
+    mDrawBuffers[1 - mFrontBuffer].Clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void API::DiscardDrawCommands(void)
+{
+    mDrawBuffers[1 - mFrontBuffer].Clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t API::GetDrawCount(void)
+{
+    return (mDrawBuffers[1 - mFrontBuffer].GetSize());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint32_t API::UploadLayer(
+    const std::vector<SpriteHandle>& tiles,
+    int width,
+    int height,
+    Vec2i origin
+)
+{
+    return (mLayer.Upload(tiles, width, height, origin));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint32_t API::SetLayerTile(Vec2i cell, SpriteHandle sprite)
+{
+    return (mLayer.SetTile(cell, sprite));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-std::tuple<IGameModule::Asset, Vec2f, Color> API::PopDraw(void)
+void API::ClearLayer(void)
 {
-    auto drawable = mDrawables.front();
-    mDrawables.pop();
-    return (drawable);
+    mLayer.Clear();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-bool API::IsDrawQueueEmpty(void)
+const TileLayer& API::GetLayer(void)
 {
-    return (mDrawables.empty());
+    return (mLayer);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
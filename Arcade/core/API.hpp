@@ -6,16 +6,23 @@
 ///////////////////////////////////////////////////////////////////////////////
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
+#include "Arcade/core/DrawBuffer.hpp"
+#include "Arcade/core/SpriteRegistry.hpp"
+#include "Arcade/core/StringPool.hpp"
+#include "Arcade/core/TileLayer.hpp"
 #include "Arcade/enums/Inputs.hpp"
 #include "Arcade/interfaces/IGameModule.hpp"
 #include "Arcade/utils/Color.hpp"
+#include "Arcade/utils/RingBuffer.hpp"
+#include "Arcade/utils/Span.hpp"
 #include "Arcade/utils/Vec2.hpp"
+#include <atomic>
+#include <cstdint>
 #include <tuple>
 #include <variant>
 #include <optional>
-#include <unordered_map>
+#include <type_traits>
 #include <vector>
-#include <queue>
 #include <string>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -53,7 +60,8 @@ public:
         {
             GAME,
             GRAPHICS,
-            CORE
+            CORE,
+            CHANNEL_COUNT
         };
 
     public:
@@ -111,7 +119,7 @@ public:
         ///////////////////////////////////////////////////////////////////////
         struct SetGraphics
         {
-            std::string graphical;
+            StringId graphical;
         };
 
         ///////////////////////////////////////////////////////////////////////
@@ -120,7 +128,7 @@ public:
         ///////////////////////////////////////////////////////////////////////
         struct SetGame
         {
-            std::string game;
+            StringId game;
         };
 
         ///////////////////////////////////////////////////////////////////////
@@ -147,8 +155,8 @@ public:
         ///////////////////////////////////////////////////////////////////////
         struct Libraries
         {
-            std::vector<std::string> graphicals;
-            std::vector<std::string> games;
+            StringList graphicals;
+            StringList games;
         };
 
         ///////////////////////////////////////////////////////////////////////
@@ -164,7 +172,7 @@ public:
         ///////////////////////////////////////////////////////////////////////
         struct PlayerInformation
         {
-            std::string username;
+            StringId username;
         };
 
     private:
@@ -215,6 +223,38 @@ public:
             decltype(&mData)(nullptr)
         );
 
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Call the first handler accepting the event data
+        ///
+        /// \tparam T The event data type
+        /// \tparam Handler
+        /// \tparam Handlers
+        ///
+        /// \param data The event data
+        /// \param handler The handler tried first
+        /// \param handlers The handlers tried next
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        template <typename T, typename Handler, typename... Handlers>
+        static void Call(T& data, Handler& handler, Handlers&... handlers)
+        {
+            if constexpr (std::is_invocable_v<Handler&, T&>) {
+                handler(data);
+            } else {
+                Call(data, handlers...);
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief No handler accepts the event data, ignore it
+        ///
+        /// \tparam T The event data type
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        template <typename T>
+        static void Call(T&)
+        {}
+
     public:
         ///////////////////////////////////////////////////////////////////////
         /// \brief Default constructor
@@ -317,8 +357,51 @@ public:
         {
             return (std::visit(std::forward<Visitor>(visitor), mData));
         }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Hand the event data to the handler matching its type
+        ///
+        /// The handler is chosen at compile time for every alternative, so
+        /// the call is a single jump on the variant index instead of a chain
+        /// of GetIf. When several handlers accept a type the first one wins,
+        /// a trailing generic lambda can be used as a default.
+        ///
+        /// \tparam Handlers
+        ///
+        /// \param handlers Callables taking one event data type
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        template <typename... Handlers>
+        void Dispatch(Handlers&&... handlers)
+        {
+            std::visit([&](auto& data) {
+                Call(data, handlers...);
+            }, mData);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Hand the event data to the handler matching its type
+        ///
+        /// \tparam Handlers
+        ///
+        /// \param handlers Callables taking one event data type
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        template <typename... Handlers>
+        void Dispatch(Handlers&&... handlers) const
+        {
+            std::visit([&](const auto& data) {
+                Call(data, handlers...);
+            }, mData);
+        }
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Events carry ids into the string pool, they stay small and trivially
+    // copyable so the queues are dense
+    ///////////////////////////////////////////////////////////////////////////
+    static_assert(std::is_trivially_copyable_v<Event>, "Event is not a POD");
+
 public:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Default constructor
@@ -330,18 +413,22 @@ private:
     ///////////////////////////////////////////////////////////////////////////
     // Member data
     ///////////////////////////////////////////////////////////////////////////
-    static std::unordered_map<Event::Channel, std::queue<Event>> mEvents;
-    static std::queue<
-        std::tuple<IGameModule::Asset, Vec2f, Color>
-    > mDrawables;
+    static RingBuffer<Event> mEvents[Event::CHANNEL_COUNT];
+    static SpriteRegistry mSprites;
+    static DrawBuffer mDrawBuffers[2];
+    static int mFrontBuffer;
+    static TileLayer mLayer;
     static int mGridWidth;
     static int mGridHeight;
+    static std::uint64_t mInputCount;
+    static StringPool mStrings;
+    static std::atomic<std::uint64_t> mRandomState;
 
 public:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Poll all events one by one
     ///
-    /// \return The event
+    /// \return The event, moved out of the queue
     ///
     ///////////////////////////////////////////////////////////////////////////
     static std::optional<Event> PollEvent(Event::Channel channel);
@@ -349,13 +436,193 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Push an event to the queue
     ///
-    /// \param event The event to push
+    /// \param event The event to push, moved in the queue
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void PushEvent(Event::Channel channel, Event event);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Handle every pending event of a channel, in order
+    ///
+    /// An empty channel costs a single size check, and the events are handed
+    /// to the callback without being copied.
+    ///
+    /// \param channel The channel to empty
+    /// \param callback Called with each event, as an Event&
     ///
     ///////////////////////////////////////////////////////////////////////////
-    static void PushEvent(Event::Channel channel, const Event& event);
+    template <typename Callback>
+    static void DrainEvents(Event::Channel channel, Callback&& callback)
+    {
+        RingBuffer<Event>& queue = mEvents[channel];
+
+        while (!queue.IsEmpty()) {
+            Event event = queue.Pop();
+            callback(event);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Handle every pending event of a channel with typed handlers
+    ///
+    /// \param channel The channel to empty
+    /// \param handlers Callables taking one event data type, see
+    /// Event::Dispatch
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename... Handlers>
+    static void DispatchEvents(Event::Channel channel, Handlers&&... handlers)
+    {
+        DrainEvents(channel, [&](Event& event) {
+            event.Dispatch(handlers...);
+        });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Store a string in the string pool
+    ///
+    /// \param string The string
+    ///
+    /// \return The id to put in an event
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static StringId InternString(const std::string& string);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Store a list of strings in the string pool
+    ///
+    /// \param strings The strings
+    ///
+    /// \return The reference to put in an event
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static StringList InternStrings(const std::vector<std::string>& strings);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief Push a drawable to the queue
+    /// \brief Get a string from the string pool
+    ///
+    /// \param id The id read from an event
+    ///
+    /// \return The string, valid until the pool is destroyed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static const std::string& GetString(StringId id);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get a list of strings from the string pool
+    ///
+    /// \param list The reference read from an event
+    ///
+    /// \return A copy of the strings
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static std::vector<std::string> GetStrings(const StringList& list);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the number of key and mouse presses pushed so far
+    ///
+    /// \return The input count, compared by the core to detect idle time
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static std::uint64_t GetInputCount(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the number of events waiting on a channel
+    ///
+    /// \param channel The channel
+    ///
+    /// \return The queued event count
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static std::size_t GetEventCount(Event::Channel channel);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Restart the sequence of random seeds
+    ///
+    /// \param seed The first state of the sequence, saved in the input logs
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void SetRandomSeed(std::uint64_t seed);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the next seed of the sequence, games seed their random
+    /// generators with it instead of the time so a replay is identical
+    ///
+    /// \return The seed, different on every call
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static std::uint32_t NextRandomSeed(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Register an asset in the sprite registry
+    ///
+    /// Identical assets share the same handle, and handles stay valid for
+    /// the whole lifetime of the arcade, across game and graphics switches.
+    ///
+    /// \param asset The asset to register
+    ///
+    /// \return The handle to pass to Draw
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static SpriteHandle RegisterSprite(const IGameModule::Asset& asset);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Register a whole asset table in the sprite registry
+    ///
+    /// \param assets The assets to register
+    ///
+    /// \return The handles, in the same order as the assets
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static std::vector<SpriteHandle> RegisterSprites(
+        const std::vector<IGameModule::Asset>& assets
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the registered sprites
+    ///
+    /// \return A flat view over the registry, indexed by sprite handle
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static Span<const Sprite> GetSprites(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Record a registered sprite in the back draw buffer
+    ///
+    /// \param sprite The sprite handle
+    /// \param position The grid position
+    /// \param color The draw color
+    /// \param id The entity id used for interpolation, -1 if none
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void Draw(
+        SpriteHandle sprite,
+        Vec2f position,
+        Color color = {255, 255, 255},
+        int id = -1
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Record a registered sprite in the back draw buffer
+    ///
+    /// \param sprite The sprite handle
+    /// \param position The grid position
+    /// \param color The draw color
+    /// \param id The entity id used for interpolation, -1 if none
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void Draw(
+        SpriteHandle sprite,
+        Vec2i position,
+        Color color = {255, 255, 255},
+        int id = -1
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Record a drawable in the back draw buffer
+    ///
+    /// Convenience for one-off sprites, the asset is looked up in the sprite
+    /// registry on every call. Prefer registering once and drawing handles.
     ///
     /// \param drawable The drawable to push
     /// \param x
@@ -370,7 +637,10 @@ public:
     );
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief Push a drawable to the queue
+    /// \brief Record a drawable in the back draw buffer
+    ///
+    /// Convenience for one-off sprites, the asset is looked up in the sprite
+    /// registry on every call. Prefer registering once and drawing handles.
     ///
     /// \param drawable The drawable to push
     /// \param x
@@ -384,6 +654,52 @@ public:
         Color color = {255, 255, 255}
     );
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Upload the static tile layer drawn under the draw commands
+    ///
+    /// The grid is kept until the next upload or clear, so games only call
+    /// this when their map changes instead of drawing it every frame.
+    ///
+    /// \param tiles The row-major sprite handles, width * height of them
+    /// \param width The width in cells
+    /// \param height The height in cells
+    /// \param origin The grid position of the top left cell
+    ///
+    /// \return The new layer version
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static std::uint32_t UploadLayer(
+        const std::vector<SpriteHandle>& tiles,
+        int width,
+        int height,
+        Vec2i origin = {0, 0}
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Change a single cell of the static tile layer
+    ///
+    /// \param cell The cell, relative to the layer origin
+    /// \param sprite The new sprite handle
+    ///
+    /// \return The new layer version
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static std::uint32_t SetLayerTile(Vec2i cell, SpriteHandle sprite);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Remove the static tile layer
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void ClearLayer(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the static tile layer
+    ///
+    /// \return The layer, backends refresh their cache when its version moves
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static const TileLayer& GetLayer(void);
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -393,20 +709,33 @@ public:
     static void PlaySound(const std::string& path);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief Pop a drawable from the queue
+    /// \brief Get the draw commands of the last completed frame
+    ///
+    /// \return A view over the front draw buffer, valid until the next swap
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static Span<const DrawCommand> GetDrawCommands(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Publish the commands recorded this frame and start a new one
     ///
-    /// \return The drawable
+    ///////////////////////////////////////////////////////////////////////////
+    static void SwapDrawBuffers(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Drop the commands recorded since the last swap, when several
+    /// ticks run in one frame only the last one is drawn
     ///
     ///////////////////////////////////////////////////////////////////////////
-    static std::tuple<IGameModule::Asset, Vec2f, Color> PopDraw(void);
+    static void DiscardDrawCommands(void);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief Check if the draw queue is empty
+    /// \brief Get the number of commands recorded since the last swap
     ///
-    /// \return True if the draw queue is empty
+    /// \return The back draw buffer size
     ///
     ///////////////////////////////////////////////////////////////////////////
-    static bool IsDrawQueueEmpty(void);
+    static std::size_t GetDrawCount(void);
 };
 
 } // namespace Arc
@@ -0,0 +1,173 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Arcade/core/AllocationTracker.hpp"
+#include <cstdlib>
+#include <new>
+#ifdef ARC_DEBUG
+    #include <dlfcn.h>
+    #include <pthread.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Debug builds abort when the audio callback allocates, frees or locks
+///////////////////////////////////////////////////////////////////////////////
+#ifdef ARC_DEBUG
+    #define ARC_CHECK_REAL_TIME(call)   \
+        Arc::AllocationTracker::CheckRealTime(call)
+#else
+    #define ARC_CHECK_REAL_TIME(call)
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Replacements of the allocation functions, linked in the arcade binary only
+// so the game and graphics modules go through them too. On glibc the malloc
+// family is replaced as well, forwarding to the glibc allocator, which also
+// catches the allocations of the C libraries of the backends.
+///////////////////////////////////////////////////////////////////////////////
+#ifdef __GLIBC__
+
+extern "C"
+{
+
+///////////////////////////////////////////////////////////////////////////////
+void* __libc_malloc(std::size_t size);
+void* __libc_calloc(std::size_t count, std::size_t size);
+void* __libc_realloc(void* ptr, std::size_t size);
+void __libc_free(void* ptr);
+
+///////////////////////////////////////////////////////////////////////////////
+void* malloc(std::size_t size) noexcept
+{
+    ARC_CHECK_REAL_TIME("allocation");
+    Arc::AllocationTracker::RecordAllocation(size);
+    return (__libc_malloc(size));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void* calloc(std::size_t count, std::size_t size) noexcept
+{
+    ARC_CHECK_REAL_TIME("allocation");
+    Arc::AllocationTracker::RecordAllocation(count * size);
+    return (__libc_calloc(count, size));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void* realloc(void* ptr, std::size_t size) noexcept
+{
+    ARC_CHECK_REAL_TIME("allocation");
+    Arc::AllocationTracker::RecordAllocation(size);
+    return (__libc_realloc(ptr, size));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void free(void* ptr) noexcept
+{
+    ARC_CHECK_REAL_TIME("free");
+    Arc::AllocationTracker::RecordFree(ptr);
+    __libc_free(ptr);
+}
+
+#ifdef ARC_DEBUG
+
+///////////////////////////////////////////////////////////////////////////////
+int pthread_mutex_lock(pthread_mutex_t* mutex)
+{
+    static auto next = reinterpret_cast<int (*)(pthread_mutex_t*)>(
+        dlsym(RTLD_NEXT, "pthread_mutex_lock")
+    );
+
+    ARC_CHECK_REAL_TIME("mutex lock");
+    return (next(mutex));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pthread_mutex_trylock(pthread_mutex_t* mutex)
+{
+    static auto next = reinterpret_cast<int (*)(pthread_mutex_t*)>(
+        dlsym(RTLD_NEXT, "pthread_mutex_trylock")
+    );
+
+    ARC_CHECK_REAL_TIME("mutex lock");
+    return (next(mutex));
+}
+
+#endif
+
+} // extern "C"
+
+    #define ARC_RAW_MALLOC(size)    __libc_malloc(size)
+    #define ARC_RAW_FREE(ptr)       __libc_free(ptr)
+#else
+    #define ARC_RAW_MALLOC(size)    std::malloc(size)
+    #define ARC_RAW_FREE(ptr)       std::free(ptr)
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+void* operator new(std::size_t size)
+{
+    ARC_CHECK_REAL_TIME("allocation");
+    Arc::AllocationTracker::RecordAllocation(size);
+    if (void* ptr = ARC_RAW_MALLOC(size ? size : 1)) {
+        return (ptr);
+    }
+    throw std::bad_alloc();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void* operator new[](std::size_t size)
+{
+    return (operator new(size));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    ARC_CHECK_REAL_TIME("allocation");
+    Arc::AllocationTracker::RecordAllocation(size);
+    return (ARC_RAW_MALLOC(size ? size : 1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept
+{
+    return (operator new(size, tag));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void operator delete(void* ptr) noexcept
+{
+    ARC_CHECK_REAL_TIME("free");
+    Arc::AllocationTracker::RecordFree(ptr);
+    ARC_RAW_FREE(ptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void operator delete[](void* ptr) noexcept
+{
+    operator delete(ptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    operator delete(ptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    operator delete(ptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    operator delete(ptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    operator delete(ptr);
+}
@@ -0,0 +1,427 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Arcade/core/AllocationTracker.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <unistd.h>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<bool> AllocationTracker::mEnabled(false);
+
+///////////////////////////////////////////////////////////////////////////////
+AllocationTracker::Counters
+    AllocationTracker::mFrame[static_cast<int>(Phase::COUNT)];
+
+///////////////////////////////////////////////////////////////////////////////
+AllocationTracker::Totals
+    AllocationTracker::mTotals[static_cast<int>(Phase::COUNT)];
+
+///////////////////////////////////////////////////////////////////////////////
+AllocationTracker::Site AllocationTracker::mSites[ARC_ALLOCATION_SITES];
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::uint64_t> AllocationTracker::mDropped(0);
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t AllocationTracker::mFrameCount = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+std::ofstream AllocationTracker::mFile;
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Phase of each thread, plain data so the hooks can read it before
+/// the thread is fully set up
+///
+///////////////////////////////////////////////////////////////////////////////
+static thread_local int tPhase = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Set while the calling thread is inside the tracker, so that its
+/// own allocations are not counted
+///
+///////////////////////////////////////////////////////////////////////////////
+static thread_local bool tInside = false;
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Keep the allocations of the enclosing scope out of the counts
+///
+///////////////////////////////////////////////////////////////////////////////
+struct Suspend
+{
+    bool previous = tInside;
+
+    Suspend(void) { tInside = true; }
+    ~Suspend() { tInside = previous; }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Check if a frame is inside an allocator, a runtime library or a
+/// standard template instantiated in a module
+///
+/// \param info The frame, resolved by dladdr
+///
+/// \return True if it is not worth reporting
+///
+///////////////////////////////////////////////////////////////////////////////
+static bool IsRuntime(const Dl_info& info)
+{
+    static const char* const LIBRARIES[] = {
+        "libstdc++.", "libc.", "libc-", "libgcc_s.", "libm."
+    };
+    static const char* const SYMBOLS[] = {
+        "_Znw", "_Zna", "malloc", "calloc", "realloc",
+        "_ZN3Arc17AllocationTracker", "_ZSt", "_ZNSt", "_ZNKSt",
+        "_ZN9__gnu_cxx", "_ZNK9__gnu_cxx"
+    };
+
+    if (info.dli_fname) {
+        const char* name = std::strrchr(info.dli_fname, '/');
+
+        name = name ? name + 1 : info.dli_fname;
+        for (const char* library : LIBRARIES) {
+            if (std::strncmp(name, library, std::strlen(library)) == 0) {
+                return (true);
+            }
+        }
+    }
+    if (info.dli_sname) {
+        for (const char* symbol : SYMBOLS) {
+            if (
+                std::strncmp(info.dli_sname, symbol, std::strlen(symbol)) == 0
+            ) {
+                return (true);
+            }
+        }
+    }
+    return (false);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Describe a resolved frame
+///
+/// \param address The return address
+/// \param info The frame, resolved by dladdr
+///
+/// \return "symbol+offset (module)"
+///
+///////////////////////////////////////////////////////////////////////////////
+static std::string Describe(std::uintptr_t address, const Dl_info& info)
+{
+    std::ostringstream stream;
+    const char* module = info.dli_fname ? info.dli_fname : "??";
+    const char* slash = std::strrchr(module, '/');
+
+    if (info.dli_sname) {
+        int status = 0;
+        char* name = abi::__cxa_demangle(
+            info.dli_sname, nullptr, nullptr, &status
+        );
+
+        stream << (status == 0 ? name : info.dli_sname) << "+0x" << std::hex
+               << address - reinterpret_cast<std::uintptr_t>(info.dli_saddr);
+        std::free(name);
+    } else {
+        stream << "0x" << std::hex
+               << address - reinterpret_cast<std::uintptr_t>(info.dli_fbase);
+    }
+    stream << " (" << (slash ? slash + 1 : module) << ")";
+    return (stream.str());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AllocationTracker::Scope::Scope(Phase phase)
+    : mPrevious(static_cast<Phase>(tPhase))
+{
+    tPhase = static_cast<int>(phase);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AllocationTracker::Scope::~Scope()
+{
+    tPhase = static_cast<int>(mPrevious);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AllocationTracker::Initialize(const std::string& path)
+{
+    Suspend suspend;
+    void* frames[1];
+
+    mFile.open(path, std::ios::trunc);
+    if (!mFile) {
+        std::cerr << "Failed to write allocations " << path << std::endl;
+        return;
+    }
+    mFile << "frame";
+    for (int i = 0; i < static_cast<int>(Phase::COUNT); i++) {
+        const char* name = GetPhaseName(static_cast<Phase>(i));
+
+        mFile << "," << name << "_allocations," << name << "_bytes";
+    }
+    mFile << ",frees\n";
+
+    // The first backtrace loads the unwinder, which allocates
+    backtrace(frames, 1);
+    mEnabled = true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AllocationTracker::Shutdown(void)
+{
+    if (!mEnabled) {
+        return;
+    }
+    EndFrame();
+    mEnabled = false;
+
+    Suspend suspend;
+    double frames = static_cast<double>(std::max<std::uint64_t>(
+        mFrameCount, 1
+    ));
+
+    std::ostringstream report;
+
+    mFile.close();
+    report << "Allocations over " << mFrameCount << " frames:"
+           << std::fixed << std::setprecision(2) << std::endl;
+    for (int i = 0; i < static_cast<int>(Phase::COUNT); i++) {
+        const Totals& totals = mTotals[i];
+
+        report << "  " << std::left << std::setw(16)
+               << GetPhaseName(static_cast<Phase>(i)) << std::right
+               << std::setw(10) << totals.allocations << " allocations ("
+               << totals.allocations / frames << "/frame, "
+               << totals.frames << " frames), "
+               << totals.bytes << " bytes, "
+               << totals.frees << " frees" << std::endl;
+    }
+
+    // Stacks that only differ in the runtime libraries share a site
+    struct Aggregate
+    {
+        std::uint64_t allocations;
+        std::uint64_t bytes;
+    };
+    std::map<std::pair<int, std::string>, Aggregate> sites;
+
+    for (const Site& site : mSites) {
+        if (!site.ready.load(std::memory_order_acquire)) {
+            continue;
+        }
+
+        Aggregate& aggregate = sites[{
+            static_cast<int>(site.phase), DescribeSite(site)
+        }];
+
+        aggregate.allocations += site.allocations.load();
+        aggregate.bytes += site.bytes.load();
+    }
+
+    std::vector<std::pair<std::pair<int, std::string>, Aggregate>> top(
+        sites.begin(), sites.end()
+    );
+
+    std::sort(top.begin(), top.end(), [](const auto& a, const auto& b) {
+        return (a.second.allocations > b.second.allocations);
+    });
+    top.resize(std::min<std::size_t>(top.size(), ARC_ALLOCATION_TOP));
+    report << "Top allocation sites:" << std::endl;
+    for (const auto& [key, aggregate] : top) {
+        report << "  " << std::setw(10) << aggregate.allocations
+               << " (" << aggregate.allocations / frames << "/frame) "
+               << std::setw(10) << aggregate.bytes << " bytes  "
+               << GetPhaseName(static_cast<Phase>(key.first)) << "  "
+               << key.second << std::endl;
+    }
+    if (mDropped > 0) {
+        report << "  " << mDropped << " allocations had no free site"
+               << std::endl;
+    }
+    std::cerr << report.str();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool AllocationTracker::IsEnabled(void)
+{
+    return (mEnabled.load(std::memory_order_relaxed));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AllocationTracker::EndFrame(void)
+{
+    if (!IsEnabled()) {
+        return;
+    }
+
+    Suspend suspend;
+    std::uint64_t frees = 0;
+
+    mFile << mFrameCount;
+    for (int i = 0; i < static_cast<int>(Phase::COUNT); i++) {
+        Counters& frame = mFrame[i];
+        Totals& totals = mTotals[i];
+        std::uint64_t allocations = frame.allocations.exchange(0);
+        std::uint64_t bytes = frame.bytes.exchange(0);
+
+        std::uint64_t released = frame.frees.exchange(0);
+
+        frees += released;
+        totals.allocations += allocations;
+        totals.frees += released;
+        totals.bytes += bytes;
+        totals.frames += allocations > 0;
+        mFile << "," << allocations << "," << bytes;
+    }
+    mFile << "," << frees << "\n";
+    mFrameCount++;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AllocationTracker::RecordAllocation(std::size_t size)
+{
+    if (!mEnabled.load(std::memory_order_relaxed) || tInside) {
+        return;
+    }
+
+    Suspend suspend;
+    Counters& frame = mFrame[tPhase];
+
+    frame.allocations.fetch_add(1, std::memory_order_relaxed);
+    frame.bytes.fetch_add(size, std::memory_order_relaxed);
+    RecordSite(static_cast<Phase>(tPhase), size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AllocationTracker::RecordFree(void* ptr)
+{
+    if (!ptr || !mEnabled.load(std::memory_order_relaxed) || tInside) {
+        return;
+    }
+    mFrame[tPhase].frees.fetch_add(1, std::memory_order_relaxed);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AllocationTracker::CheckRealTime(const char* call)
+{
+    if (tPhase != static_cast<int>(Phase::AUDIO) || tInside) {
+        return;
+    }
+    tInside = true;
+
+    // Neither write nor backtrace_symbols_fd allocate
+    static const char prefix[] = "[ARCADE] Audio callback: ";
+    void* frames[32];
+    int depth = backtrace(frames, 32);
+
+    (void)!write(STDERR_FILENO, prefix, sizeof(prefix) - 1);
+    (void)!write(STDERR_FILENO, call, std::strlen(call));
+    (void)!write(STDERR_FILENO, "\n", 1);
+    backtrace_symbols_fd(frames, depth, STDERR_FILENO);
+    std::abort();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const char* AllocationTracker::GetPhaseName(Phase phase)
+{
+    switch (phase) {
+        case Phase::CORE:
+            return ("core");
+        case Phase::LOADER:
+            return ("loader");
+        case Phase::GRAPHICS_UPDATE:
+            return ("graphics_update");
+        case Phase::GRAPHICS_RENDER:
+            return ("graphics_render");
+        case Phase::GAME_TICK:
+            return ("game_tick");
+        case Phase::AUDIO:
+            return ("audio");
+        default:
+            return ("unknown");
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AllocationTracker::RecordSite(Phase phase, std::size_t size)
+{
+    void* frames[ARC_ALLOCATION_DEPTH + 1];
+    int depth = backtrace(frames, ARC_ALLOCATION_DEPTH + 1) - 1;
+    std::uint64_t hash = 1469598103934665603ull ^ static_cast<int>(phase);
+
+    // The first frame is RecordSite itself
+    for (int i = 1; i <= depth; i++) {
+        hash = (hash ^ reinterpret_cast<std::uintptr_t>(frames[i]))
+            * 1099511628211ull;
+    }
+    hash = hash ? hash : 1;
+
+    for (int probe = 0; probe < ARC_ALLOCATION_PROBES; probe++) {
+        Site& site = mSites[(hash + probe) % ARC_ALLOCATION_SITES];
+        std::uint64_t key = site.key.load(std::memory_order_acquire);
+
+        if (key == 0 && site.key.compare_exchange_strong(key, hash)) {
+            for (int i = 0; i < depth; i++) {
+                site.frames[i] = reinterpret_cast<std::uintptr_t>(
+                    frames[i + 1]
+                );
+            }
+            site.depth = std::max(depth, 0);
+            site.phase = phase;
+            site.ready.store(true, std::memory_order_release);
+            key = hash;
+        }
+        if (key == hash) {
+            site.allocations.fetch_add(1, std::memory_order_relaxed);
+            site.bytes.fetch_add(size, std::memory_order_relaxed);
+            return;
+        }
+    }
+    mDropped.fetch_add(1, std::memory_order_relaxed);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::string AllocationTracker::DescribeSite(const Site& site)
+{
+    for (int i = 0; i < site.depth; i++) {
+        Dl_info info = {};
+
+        // Return addresses point after the call, step back into it
+        if (!dladdr(reinterpret_cast<void*>(site.frames[i] - 1), &info)) {
+            continue;
+        }
+        if (IsRuntime(info)) {
+            continue;
+        }
+
+        std::string description = Describe(site.frames[i], info);
+
+        if (i + 1 < site.depth) {
+            Dl_info caller = {};
+            void* address = reinterpret_cast<void*>(site.frames[i + 1] - 1);
+
+            if (dladdr(address, &caller)) {
+                description += " < " + Describe(site.frames[i + 1], caller);
+            }
+        }
+        return (description);
+    }
+    return ("??");
+}
+
+} // namespace Arc
@@ -0,0 +1,235 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+//
+///////////////////////////////////////////////////////////////////////////////
+#define ARC_ALLOCATION_SITES        4096
+#define ARC_ALLOCATION_PROBES       32
+#define ARC_ALLOCATION_DEPTH        8
+#define ARC_ALLOCATION_TOP          10
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Counts the heap allocations of the arcade, per frame and per phase
+///
+/// The arcade binary replaces operator new, operator delete and the malloc
+/// family, see AllocationHooks.cpp, and reports every call here. Each
+/// thread runs in a phase, set with a Scope, and its allocations are
+/// counted in that phase and under their call stack, in a fixed table of
+/// ARC_ALLOCATION_SITES sites updated without locks.
+///
+/// Every frame, EndFrame writes the allocations, bytes and frees of each
+/// phase as a CSV line. Shutdown prints the totals and the most frequent
+/// call sites. Disabled, a call costs one relaxed atomic load.
+///
+///////////////////////////////////////////////////////////////////////////////
+class AllocationTracker
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief What a thread is running
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    enum class Phase
+    {
+        CORE,
+        LOADER,
+        GRAPHICS_UPDATE,
+        GRAPHICS_RENDER,
+        GAME_TICK,
+        AUDIO,
+        COUNT
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Run the rest of the enclosing scope in a phase
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    class Scope
+    {
+    private:
+        ///////////////////////////////////////////////////////////////////////
+        // Member data
+        ///////////////////////////////////////////////////////////////////////
+        Phase mPrevious;                    //<! Restored at the end
+
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Enter the phase
+        ///
+        /// \param phase The phase of the calling thread
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        explicit Scope(Phase phase);
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Go back to the previous phase
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        ~Scope();
+
+        ///////////////////////////////////////////////////////////////////////
+        //
+        ///////////////////////////////////////////////////////////////////////
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Counters of a phase
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Counters
+    {
+        std::atomic<std::uint64_t> allocations; //<! Calls
+        std::atomic<std::uint64_t> bytes;       //<! Requested
+        std::atomic<std::uint64_t> frees;       //<! Non-null releases
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A call stack seen allocating, in a phase
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Site
+    {
+        std::atomic<std::uint64_t> key;     //<! Stack hash, 0 when free
+        std::atomic<bool> ready;            //<! Frames written
+        std::uintptr_t frames[ARC_ALLOCATION_DEPTH]; //<! Innermost first
+        int depth;                          //<! Frames captured
+        Phase phase;                        //<! Of the allocations
+        std::atomic<std::uint64_t> allocations; //<! Calls
+        std::atomic<std::uint64_t> bytes;   //<! Requested
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Totals of a phase since Initialize
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Totals
+    {
+        std::uint64_t allocations;          //<! Calls
+        std::uint64_t bytes;                //<! Requested
+        std::uint64_t frees;                //<! Non-null releases
+        std::uint64_t frames;               //<! Frames with allocations
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Member data
+    ///////////////////////////////////////////////////////////////////////////
+    static std::atomic<bool> mEnabled;
+    static Counters mFrame[static_cast<int>(Phase::COUNT)];
+    static Totals mTotals[static_cast<int>(Phase::COUNT)];
+    static Site mSites[ARC_ALLOCATION_SITES];
+    static std::atomic<std::uint64_t> mDropped;
+    static std::uint64_t mFrameCount;
+    static std::ofstream mFile;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Start counting, and write one line per frame in a CSV file
+    ///
+    /// \param path The CSV file
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void Initialize(const std::string& path);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Stop counting and print the totals and the top call sites
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void Shutdown(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Check if the allocations are counted
+    ///
+    /// \return True between Initialize and Shutdown
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static bool IsEnabled(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Write the counters of the frame and reset them, once per frame
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void EndFrame(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Count an allocation of the calling thread, from the hooks
+    ///
+    /// \param size The requested size
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void RecordAllocation(std::size_t size);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Count a release of the calling thread, from the hooks
+    ///
+    /// \param ptr The released memory
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void RecordFree(void* ptr);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Abort on a call the audio callback must not make
+    ///
+    /// Called by the hooks of debug builds, see ARC_DEBUG: the callback runs
+    /// on the real-time thread of the device, where an allocation or a lock
+    /// can miss the deadline of the buffer. The stack is printed first.
+    ///
+    /// \param call What the callback did
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void CheckRealTime(const char* call);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the name of a phase
+    ///
+    /// \param phase The phase
+    ///
+    /// \return Its name, as written in the CSV header
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static const char* GetPhaseName(Phase phase);
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Count an allocation under its call stack
+    ///
+    /// \param phase The phase of the calling thread
+    /// \param size The requested size
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void RecordSite(Phase phase, std::size_t size);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Describe the first frame of a stack outside the allocators
+    /// and the runtime libraries, and its caller
+    ///
+    /// \param site The site
+    ///
+    /// \return The location, "??" if none is known
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static std::string DescribeSite(const Site& site);
+};
+
+} // namespace Arc
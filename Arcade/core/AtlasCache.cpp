@@ -0,0 +1,253 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Arcade/core/AtlasCache.hpp"
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// stb_image, only the core decodes images
+///////////////////////////////////////////////////////////////////////////////
+#define STB_IMAGE_IMPLEMENTATION
+#include "Arcade/core/stb_image.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward namespace std::filesystem
+///////////////////////////////////////////////////////////////////////////////
+namespace fs = std::filesystem;
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Header of an atlas file, followed by the RGBA pixels
+///
+///////////////////////////////////////////////////////////////////////////////
+struct AtlasHeader
+{
+    char magic[4];                          //<! ARC_ATLAS_MAGIC
+    std::uint32_t version;                  //<! ARC_ATLAS_VERSION
+    std::uint64_t hash;                     //<! Hash of the source image
+    std::uint32_t width;                    //<! In pixels
+    std::uint32_t height;                   //<! In pixels
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief FNV-1a hash of a buffer
+///
+/// \param data The buffer
+///
+/// \return The hash
+///
+///////////////////////////////////////////////////////////////////////////////
+static std::uint64_t Hash(const std::vector<std::uint8_t>& data)
+{
+    std::uint64_t hash = 0xcbf29ce484222325ull;
+
+    for (std::uint8_t byte : data) {
+        hash = (hash ^ byte) * 0x100000001b3ull;
+    }
+    return (hash);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AtlasCache::AtlasCache(bool persist)
+    : mPersist(persist)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+AtlasCache::~AtlasCache()
+{
+    for (const auto& [hash, atlas] : mAtlases) {
+        if (atlas->mapping) {
+            munmap(atlas->mapping, atlas->mappingSize);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::optional<PixelView> AtlasCache::Get(const std::string& path)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    struct stat info;
+
+    if (stat(path.c_str(), &info) != 0) {
+        return (std::nullopt);
+    }
+
+    auto file = mFiles.find(path);
+
+    if (
+        file != mFiles.end() &&
+        file->second.inode == info.st_ino &&
+        file->second.mtime.tv_sec == info.st_mtim.tv_sec &&
+        file->second.mtime.tv_nsec == info.st_mtim.tv_nsec &&
+        file->second.size == info.st_size
+    ) {
+        auto atlas = mAtlases.find(file->second.hash);
+
+        if (atlas != mAtlases.end()) {
+            return (atlas->second->view);
+        }
+    }
+
+    std::ifstream stream(path, std::ios::binary);
+    std::vector<std::uint8_t> data(info.st_size);
+
+    stream.read(reinterpret_cast<char*>(data.data()), data.size());
+    if (!stream) {
+        return (std::nullopt);
+    }
+
+    std::uint64_t hash = Hash(data);
+    auto atlas = mAtlases.find(hash);
+
+    mFiles[path] = {info.st_ino, info.st_mtim, info.st_size, hash};
+    if (atlas == mAtlases.end()) {
+        std::string atlasPath = path + ARC_ATLAS_EXTENSION;
+        std::unique_ptr<Atlas> decoded;
+
+        if (mPersist) {
+            decoded = Map(atlasPath, hash);
+        }
+        if (!decoded) {
+            decoded = Decode(data);
+            if (!decoded) {
+                return (std::nullopt);
+            }
+            if (mPersist) {
+                Write(atlasPath, hash, *decoded);
+            }
+        }
+        atlas = mAtlases.emplace(hash, std::move(decoded)).first;
+    }
+    return (atlas->second->view);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::unique_ptr<AtlasCache::Atlas> AtlasCache::Map(
+    const std::string& path,
+    std::uint64_t hash
+)
+{
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    struct stat info;
+
+    if (fd < 0) {
+        return (nullptr);
+    }
+    if (
+        fstat(fd, &info) != 0 ||
+        static_cast<size_t>(info.st_size) < sizeof(AtlasHeader)
+    ) {
+        close(fd);
+        return (nullptr);
+    }
+
+    size_t size = static_cast<size_t>(info.st_size);
+    void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return (nullptr);
+    }
+
+    AtlasHeader header;
+
+    std::memcpy(&header, mapping, sizeof(header));
+    if (
+        std::memcmp(header.magic, ARC_ATLAS_MAGIC, 4) != 0 ||
+        header.version != ARC_ATLAS_VERSION ||
+        header.hash != hash ||
+        size - sizeof(header) !=
+            static_cast<size_t>(header.width) * header.height * 4
+    ) {
+        munmap(mapping, size);
+        return (nullptr);
+    }
+
+    std::unique_ptr<Atlas> atlas = std::make_unique<Atlas>();
+
+    atlas->mapping = mapping;
+    atlas->mappingSize = size;
+    atlas->view = {
+        static_cast<const std::uint8_t*>(mapping) + sizeof(header),
+        header.width, header.height
+    };
+    return (atlas);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::unique_ptr<AtlasCache::Atlas> AtlasCache::Decode(
+    const std::vector<std::uint8_t>& data
+)
+{
+    int width, height, channels;
+    stbi_uc* pixels = stbi_load_from_memory(
+        data.data(), data.size(), &width, &height, &channels, 4
+    );
+
+    if (!pixels) {
+        return (nullptr);
+    }
+
+    std::unique_ptr<Atlas> atlas = std::make_unique<Atlas>();
+
+    atlas->pixels.assign(pixels, pixels + width * height * 4);
+    atlas->mapping = nullptr;
+    atlas->mappingSize = 0;
+    atlas->view = {
+        atlas->pixels.data(),
+        static_cast<unsigned int>(width),
+        static_cast<unsigned int>(height)
+    };
+    stbi_image_free(pixels);
+    return (atlas);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AtlasCache::Write(
+    const std::string& path,
+    std::uint64_t hash,
+    const Atlas& atlas
+) const
+{
+    fs::path temporary = path + ".tmp";
+    AtlasHeader header;
+
+    std::memcpy(header.magic, ARC_ATLAS_MAGIC, 4);
+    header.version = ARC_ATLAS_VERSION;
+    header.hash = hash;
+    header.width = atlas.view.width;
+    header.height = atlas.view.height;
+
+    // The image directory may be read-only, the atlas is then decoded on
+    // every run
+    std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(
+        reinterpret_cast<const char*>(atlas.view.pixels),
+        static_cast<std::streamsize>(atlas.view.width) *
+            atlas.view.height * 4
+    );
+    file.close();
+
+    std::error_code error;
+
+    if (!file) {
+        fs::remove(temporary, error);
+        return;
+    }
+    fs::rename(temporary, path, error);
+}
+
+} // namespace Arc
@@ -0,0 +1,157 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Arcade/utils/PixelView.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <sys/types.h>
+#include <unordered_map>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+//
+///////////////////////////////////////////////////////////////////////////////
+#define ARC_ATLAS_EXTENSION         ".atlas"
+#define ARC_ATLAS_MAGIC             "ARCT"
+#define ARC_ATLAS_VERSION           1
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Decoded sprite sheets, shared by every graphics module
+///
+/// A sheet is decoded once per content: files are recognized by inode,
+/// modification time and size, then by the hash of their bytes, so a
+/// sheet copied under another path is not decoded again.
+///
+/// When persisting, the decoded pixels are also written next to the
+/// image, with the ARC_ATLAS_EXTENSION suffix, and mapped back on the next
+/// run instead of decoding. The file stores the hash of the image it was
+/// decoded from and is rewritten when the image changes.
+///
+/// Atlases are never evicted, the views stay valid until the cache is
+/// destroyed. Get may be called from any thread.
+///
+///////////////////////////////////////////////////////////////////////////////
+class AtlasCache
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Identity of an image file seen before
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct File
+    {
+        ino_t inode;                        //<! File identity
+        std::timespec mtime;                //<! Last modification
+        off_t size;                         //<! File size
+        std::uint64_t hash;                 //<! Hash of the content
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Decoded pixels, owned or mapped from an atlas file
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Atlas
+    {
+        std::vector<std::uint8_t> pixels;   //<! Decoded, if not mapped
+        void* mapping;                      //<! Atlas file or nullptr
+        std::size_t mappingSize;            //<! Mapped bytes
+        PixelView view;                     //<! Into pixels or mapping
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Member data
+    ///////////////////////////////////////////////////////////////////////////
+    bool mPersist;                          //<! Read and write atlas files
+    std::mutex mMutex;                      //<! Guards the maps
+    std::unordered_map<std::string, File> mFiles;   //<! By image path
+    std::unordered_map<
+        std::uint64_t, std::unique_ptr<Atlas>
+    > mAtlases;                             //<! By content hash
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor
+    ///
+    /// \param persist Whether to keep the decoded pixels in atlas files
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit AtlasCache(bool persist = true);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Destructor, unmaps the atlas files
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ~AtlasCache();
+
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    AtlasCache(const AtlasCache&) = delete;
+    AtlasCache& operator=(const AtlasCache&) = delete;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the pixels of an image, decoding it if needed
+    ///
+    /// \param path The image path
+    ///
+    /// \return The pixels, or nothing if the image cannot be read
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::optional<PixelView> Get(const std::string& path);
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Map an atlas file decoded from an image of a given hash
+    ///
+    /// \param path The atlas file path
+    /// \param hash The hash of the image
+    ///
+    /// \return The atlas, or nullptr if the file is missing or stale
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::unique_ptr<Atlas> Map(const std::string& path, std::uint64_t hash);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Decode an image
+    ///
+    /// \param data The image file content
+    ///
+    /// \return The atlas, or nullptr if the image cannot be decoded
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::unique_ptr<Atlas> Decode(const std::vector<std::uint8_t>& data);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Write an atlas file, errors are ignored
+    ///
+    /// \param path The atlas file path
+    /// \param hash The hash of the image
+    /// \param atlas The decoded image
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Write(
+        const std::string& path,
+        std::uint64_t hash,
+        const Atlas& atlas
+    ) const;
+};
+
+} // namespace Arc
@@ -2,35 +2,116 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "Arcade/core/Core.hpp"
+#include "Arcade/core/AllocationTracker.hpp"
 #include "Arcade/core/Library.hpp"
+#include "Arcade/core/ModuleDescriptor.hpp"
+#include "Arcade/core/Profiler.hpp"
 #include "Arcade/core/API.hpp"
 #include "Arcade/shared/Joystick.hpp"
 #include "Arcade/audio/Audio.hpp"
 #include "Arcade/shared/WiiMote.hpp"
 #include "Arcade/errors/Exception.hpp"
-#include <chrono>
-#include <filesystem>
-#include <fstream>
+#include "Arcade/utils/Environment.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <iterator>
+#include <random>
 
 ///////////////////////////////////////////////////////////////////////////////
-// Forward namespace std::filesystem
+// Namespace Arc
 ///////////////////////////////////////////////////////////////////////////////
-namespace fs = std::filesystem;
+namespace Arc
+{
 
 ///////////////////////////////////////////////////////////////////////////////
-// Namespace Arc
+/// \brief Read a rate from the environment
+///
+/// \param name The environment variable
+/// \param fallback The rate used when the variable is unset or invalid
+///
+/// \return The rate in hertz
+///
 ///////////////////////////////////////////////////////////////////////////////
-namespace Arc
+static float GetRate(const char* name, float fallback)
 {
+    const char* value = std::getenv(name);
+    char* end = nullptr;
+
+    if (value == nullptr) {
+        return (fallback);
+    }
+
+    float rate = std::strtof(value, &end);
+
+    if (end == value || rate < 0.f) {
+        std::cerr << "ERROR: Invalid " << name << ", using "
+                  << fallback << " instead." << std::endl;
+        return (fallback);
+    }
+    return (rate);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Preload a library of a list, wrapping around its ends
+///
+/// \tparam T The module type
+///
+/// \param libs The libraries, by path
+/// \param index The index in the list, may be out of bounds
+///
+/// \return The path of the library, empty if the list is
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+static std::string PreloadAt(
+    const std::map<std::string, std::string>& libs,
+    int index
+)
+{
+    int size = static_cast<int>(libs.size());
+
+    if (size == 0) {
+        return ("");
+    }
+
+    auto it = libs.begin();
+
+    std::advance(it, (index % size + size) % size);
+    Library::Preload<T>(it->first);
+    return (it->first);
+}
 
 ///////////////////////////////////////////////////////////////////////////////
 Core::Core(const std::string& graphicLib, const std::string& gameLib)
-    : mIsWindowOpen(true)
+    : mAtlases(GetFlag("ARCADE_ATLAS_FILES", true))
+    , mHud(GetFlag("ARCADE_HUD", false))
+    , mIsWindowOpen(true)
     , mTimer(0.f)
+    , mScheduler(
+        GetRate("ARCADE_TICK_RATE", ARC_DEFAULT_TICK_RATE),
+        GetRate("ARCADE_FRAME_RATE", 0.f)
+    )
+    , mInputCount(0)
+    , mSwitchCount(0)
+    , mSwitchTotal(0.f)
+    , mSwitchWorst(0.f)
 {
+    mScheduler.SetIdle(
+        GetRate("ARCADE_IDLE_RATE", ARC_DEFAULT_IDLE_RATE),
+        GetRate("ARCADE_IDLE_DELAY", ARC_DEFAULT_IDLE_DELAY)
+    );
+    if (const char* allocations = std::getenv("ARCADE_ALLOCS")) {
+        AllocationTracker::Initialize(allocations);
+    }
+    if (const char* trace = std::getenv("ARCADE_PROFILE")) {
+        Profiler::Initialize(trace);
+        Profiler::SetThreadName("Main");
+    }
+    OpenInputLog();
     SetLibraries(graphicLib, gameLib);
+    OnGameChanged();
 
-    mGraphics->LoadSpriteSheet(mStates.top()->GetSpriteSheet());
+    LoadSpriteSheet();
 
     WiiMote::Initialize();
 
@@ -45,7 +126,9 @@ Core::Core(const std::string& graphicLib, const std::string& gameLib)
         graphicals.push_back(name);
     }
 
-    API::PushEvent(API::Event::GAME, API::Event::Libraries{graphicals, games});
+    API::PushEvent(API::Event::GAME, API::Event::Libraries{
+        API::InternStrings(graphicals), API::InternStrings(games)
+    });
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -54,7 +137,14 @@ void Core::SetLibraries(
     const std::string& gameLib
 )
 {
-    if (!Library::Is<IGraphicsModule>(graphicLib)) {
+    std::optional<ModuleDescriptor> descriptor =
+        ReadModuleDescriptor(graphicLib);
+
+    // Hidden backends are not listed, but can be asked for by path
+    if (
+        !(descriptor && descriptor->kind == MODULE_GRAPHICS) &&
+        !Library::Is<IGraphicsModule>(graphicLib)
+    ) {
         mGraphicLib = "lib/arcade_sfml.so";
         std::cerr << "ERROR: Invalid Graphics libraries, using SFML instead."
                   << std::endl;
@@ -79,28 +169,14 @@ void Core::SetLibraries(
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Core::GetLibraries(void)
+bool Core::GetLibraries(void)
 {
-    mGraphicLibs.clear();
-    mGameLibs.clear();
-
-    try {
-        for (const auto& entry : fs::directory_iterator("lib")) {
-            if (!entry.is_regular_file() || entry.path().extension() != ".so") {
-                continue;
-            }
-
-            std::string path = entry.path().string();
-
-            if (auto name = Library::Is<IGraphicsModule>(path)) {
-                mGraphicLibs[path] = name.value();
-            } else if (auto name = Library::Is<IGameModule>(path)) {
-                mGameLibs[path] = name.value();
-            }
-        }
-    } catch (const fs::filesystem_error& e) {
-        std::cerr << "Error accessing directory: " << e.what() << std::endl;
+    if (!mLibraries.Refresh()) {
+        return (false);
     }
+    mGraphicLibs = mLibraries.GetGraphics();
+    mGameLibs = mLibraries.GetGames();
+    return (true);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -109,48 +185,7 @@ void Core::SaveScore(int score)
     if (mUserName.empty()) {
         return;
     }
-
-    if (!fs::exists(".saves")) {
-        fs::create_directory(".saves");
-    }
-
-    std::string savePath = ".saves/" + mUserName + ".save";
-    std::string gameName = mStates.top()->GetName();
-    int currentScore = score;
-
-    std::map<std::string, int> scores;
-
-    std::ifstream saveFile(savePath);
-    if (saveFile.is_open()) {
-        std::string line;
-        while (std::getline(saveFile, line)) {
-            size_t sep = line.find(':');
-            if (sep != std::string::npos) {
-                std::string game = line.substr(0, sep);
-                int score = std::stoi(line.substr(sep + 1));
-                scores[game] = score;
-            }
-        }
-        saveFile.close();
-    }
-
-    if (
-        scores.find(gameName) == scores.end() ||
-        currentScore > scores[gameName]
-    ) {
-        scores[gameName] = currentScore;
-    }
-
-    std::ofstream outFile(savePath);
-    if (outFile.is_open()) {
-        for (const auto& [game, score] : scores) {
-            outFile << game << ":" << score << std::endl;
-        }
-        outFile.close();
-    } else {
-        std::cerr << "Failed to open save file for writing: "
-                  << savePath << std::endl;
-    }
+    mScores.Submit(mUserName, mGameName, score);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -166,49 +201,49 @@ void Core::SetGame(const std::string& game)
     if (path.empty()) {
         return;
     }
+    BeginGameSwitch(path);
+}
 
-    mGameLib = path;
-    if (mStates.top()->GetName() != "MenuGUI") {
-        mStates.top()->EndPlay();
-        mStates.pop();
+///////////////////////////////////////////////////////////////////////////////
+void Core::OnGameChanged(void)
+{
+    mGameName = mStates.top()->GetName();
+    mBestScore.reset();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Core::LoadSpriteSheet(void)
+{
+    ARC_PROFILE_ZONE("Core::LoadSpriteSheet");
+
+    std::string path = mStates.top()->GetSpriteSheet();
+    std::optional<PixelView> sheet = mAtlases.Get(path);
+
+    if (sheet) {
+        mGraphics->LoadSpriteSheetPixels(mHud.ComposeSheet(*sheet));
+    } else {
+        mHud.ResetSheet();
+        mGraphics->LoadSpriteSheet(path);
     }
-    mStates.push(Library::Load<IGameModule>(path));
-    mGraphics->LoadSpriteSheet(mStates.top()->GetSpriteSheet());
-    mGraphics->SetTitle(mStates.top()->GetName());
-    mStates.top()->BeginPlay();
-    SendBestScore();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void Core::SendBestScore(void)
 {
+    ARC_PROFILE_ZONE("Core::SendBestScore");
+
     if (mUserName.empty()) {
         return;
     }
 
-    std::string savePath = ".saves/" + mUserName + ".save";
-    std::string gameName = mStates.top()->GetName();
-    int currentScore = 0;
-
-    std::ifstream saveFile(savePath);
-    if (saveFile.is_open()) {
-        std::string line;
-        while (std::getline(saveFile, line)) {
-            size_t sep = line.find(':');
-            if (sep != std::string::npos) {
-                std::string game = line.substr(0, sep);
-                int score = std::stoi(line.substr(sep + 1));
-                if (game == gameName) {
-                    currentScore = score;
-                    break;
-                }
-            }
-        }
-        saveFile.close();
-    }
+    int best = mScores.GetBest(mUserName, mGameName);
 
+    if (mBestScore == best) {
+        return;
+    }
+    mBestScore = best;
     API::PushEvent(API::Event::Channel::GAME,
-        API::Event::BestScore{currentScore}
+        API::Event::BestScore{best}
     );
 }
 
@@ -226,17 +261,20 @@ void Core::SetGraphics(const std::string& graphics)
         return;
     }
 
+    FrameScheduler::Clock::time_point start = FrameScheduler::Clock::now();
+
     mGraphicLib = path;
     mGraphics.reset();
     try {
         mGraphics = Library::Load<IGraphicsModule>(path);
-        mGraphics->LoadSpriteSheet(mStates.top()->GetSpriteSheet());
+        LoadSpriteSheet();
         mGraphics->SetTitle(mStates.top()->GetName());
         mStates.top()->BeginPlay();
     } catch (const std::exception& e) {
         std::cerr << "Failed to load graphics library: "
                   << e.what() << std::endl;
     }
+    EndSwitch(start);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -274,11 +312,10 @@ void Core::HandleKeyPressed(EKeyboardKey code)
             if (mStates.size() > 1) {
                 mStates.top()->EndPlay();
                 mStates.pop();
-                mGraphics->LoadSpriteSheet(
-                    mStates.top()->GetSpriteSheet()
-                );
+                LoadSpriteSheet();
                 mGraphics->SetTitle(mStates.top()->GetName());
                 mStates.top()->BeginPlay();
+                OnGameChanged();
             }
             break;
         }
@@ -287,6 +324,18 @@ void Core::HandleKeyPressed(EKeyboardKey code)
                 WiiMote::Connect();
             }
             break;
+        case EKeyboardKey::H:
+            mHud.SetEnabled(!mHud.IsEnabled());
+            if (mHud.IsEnabled()) {
+                LoadSpriteSheet();
+            }
+            break;
+        case EKeyboardKey::T:
+            if (Profiler::IsEnabled()) {
+                Profiler::RequestDump();
+                break;
+            }
+            [[fallthrough]];
         default:
             API::PushEvent(API::Event::Channel::GAME,
                 API::Event::KeyPressed{code}
@@ -313,14 +362,14 @@ void Core::HandleGraphicsRotation(int delta)
     }
 
     auto currentGame = mStates.top();
+    FrameScheduler::Clock::time_point start = FrameScheduler::Clock::now();
 
     mGraphics.reset();
 
     try {
-        mGraphics = Library::Load<IGraphicsModule>(
-            libs[mGraphicLibIdx]
-        );
-        mGraphics->LoadSpriteSheet(currentGame->GetSpriteSheet());
+        mGraphicLib = libs[mGraphicLibIdx];
+        mGraphics = Library::Load<IGraphicsModule>(mGraphicLib);
+        LoadSpriteSheet();
         mGraphics->SetTitle(currentGame->GetName());
 
         currentGame->BeginPlay();
@@ -328,6 +377,7 @@ void Core::HandleGraphicsRotation(int delta)
         std::cerr << "Failed to load graphics library: "
                   << e.what() << std::endl;
     }
+    EndSwitch(start);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -341,55 +391,333 @@ void Core::HandleGameRotation(int delta)
 
     API::PushEvent(API::Event::Channel::GRAPHICS, API::Event::ChangeGame{0});
 
-    mGameLibIdx += delta;
+    // Rotating again during a load goes on from the game being loaded,
+    // mGameLibIdx only follows the committed game
+    int index = mGameLibIdx;
 
-    if (mGameLibIdx < 0) {
-        mGameLibIdx = libs.size() - 1;
-    } else if (mGameLibIdx >= (int)libs.size()) {
-        mGameLibIdx = 0;
+    if (mPendingGame) {
+        auto pending = mGameLibs.find(mPendingGame->path);
+
+        if (pending != mGameLibs.end()) {
+            index = std::distance(mGameLibs.begin(), pending);
+        }
+    }
+
+    index += delta;
+
+    if (index < 0) {
+        index = libs.size() - 1;
+    } else if (index >= (int)libs.size()) {
+        index = 0;
     }
 
     Audio::StopAll();
 
-    if (mStates.top()->GetName() != "MenuGUI") {
-        mStates.top()->EndPlay();
-        mStates.pop();
+    BeginGameSwitch(libs[index]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Core::BeginGameSwitch(const std::string& path)
+{
+    if (mPendingGame) {
+        mPendingGame->path = path;
+        return;
     }
+    mPendingGame.emplace();
+    mPendingGame->path = path;
+    mPendingGame->start = FrameScheduler::Clock::now();
+    LoadPendingGame();
+}
 
-    mStates.push(Library::Load<IGameModule>(libs[mGameLibIdx]));
-    mGraphics->LoadSpriteSheet(mStates.top()->GetSpriteSheet());
+///////////////////////////////////////////////////////////////////////////////
+void Core::LoadPendingGame(void)
+{
+    std::string path = mPendingGame->path;
 
-    mGraphics->SetTitle(mStates.top()->GetName());
+    mPendingGame->loading = path;
+    mPendingGame->module = std::async(std::launch::async, [this, path] {
+        Profiler::SetThreadName("Loader");
+        ARC_PROFILE_ZONE("LoadGame");
+        AllocationTracker::Scope scope(AllocationTracker::Phase::LOADER);
 
-    mStates.top()->BeginPlay();
+        std::shared_ptr<IGameModule> module = Library::Load<IGameModule>(
+            path
+        );
+
+        mAtlases.Get(module->GetSpriteSheet());
+        return (module);
+    });
+
+    auto name = mGameLibs.find(path);
+
+    if (name != mGameLibs.end()) {
+        mGraphics->SetTitle("Loading " + name->second);
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Core::HandleEvents(void)
+void Core::UpdateGameSwitch(void)
+{
+    if (!mPendingGame) {
+        return;
+    }
+
+    // Nothing ticks until the commit, the events are kept for the game on
+    // top once it is done, whether the load succeeded or not
+    API::DrainEvents(API::Event::GAME, [this](API::Event& event) {
+        mHeldEvents.push_back(event);
+    });
+
+    // With an input log the game is committed on the frame it was asked
+    // for, whatever the time it takes to load
+    if (
+        !mInputLog &&
+        mPendingGame->module.wait_for(std::chrono::seconds(0)) !=
+            std::future_status::ready
+    ) {
+        return;
+    }
+
+    ARC_PROFILE_ZONE("Core::CommitGame");
+    std::shared_ptr<IGameModule> module;
+
+    try {
+        module = mPendingGame->module.get();
+    } catch (const std::exception& e) {
+        std::cerr << "Failed to load game library: "
+                  << e.what() << std::endl;
+    }
+
+    // Another game was asked for while this one was loading
+    if (mPendingGame->path != mPendingGame->loading) {
+        LoadPendingGame();
+        return;
+    }
+
+    FrameScheduler::Clock::time_point start = mPendingGame->start;
+    std::string path = mPendingGame->path;
+
+    // mGameLib and mGameLibIdx keep naming the running game on a failure
+    mPendingGame.reset();
+    if (!module) {
+        mGraphics->SetTitle(mStates.top()->GetName());
+    } else {
+        auto game = mGameLibs.find(path);
+
+        mGameLib = path;
+        if (game != mGameLibs.end()) {
+            mGameLibIdx = std::distance(mGameLibs.begin(), game);
+        }
+        if (mStates.top()->GetName() != "MenuGUI") {
+            mStates.top()->EndPlay();
+            mStates.pop();
+        }
+        API::ClearLayer();
+        mStates.push(module);
+        LoadSpriteSheet();
+        mGraphics->SetTitle(mStates.top()->GetName());
+        mStates.top()->BeginPlay();
+        OnGameChanged();
+        EndSwitch(start);
+    }
+
+    for (const API::Event& event : mHeldEvents) {
+        API::PushEvent(API::Event::GAME, event);
+    }
+    mHeldEvents.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Core::EndSwitch(FrameScheduler::Clock::time_point start)
+{
+    float seconds = std::chrono::duration<float>(
+        FrameScheduler::Clock::now() - start
+    ).count();
+
+    mSwitchCount++;
+    mSwitchTotal += seconds;
+    mSwitchWorst = std::max(mSwitchWorst, seconds);
+    PreloadNeighbours();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Core::PreloadNeighbours(void)
+{
+    auto graphics = mGraphicLibs.find(mGraphicLib);
+    auto game = mGameLibs.find(mGameLib);
+
+    if (graphics != mGraphicLibs.end()) {
+        mGraphicLibIdx = std::distance(mGraphicLibs.begin(), graphics);
+    }
+    if (game != mGameLibs.end()) {
+        mGameLibIdx = std::distance(mGameLibs.begin(), game);
+    }
+
+    std::vector<std::string> games;
+
+    for (int delta : {-1, 1}) {
+        PreloadAt<IGraphicsModule>(mGraphicLibs, mGraphicLibIdx + delta);
+        games.push_back(PreloadAt<IGameModule>(mGameLibs, mGameLibIdx + delta));
+    }
+
+    // The sheets named by the descriptors are decoded ahead of the switch,
+    // one batch at a time
+    if (
+        mSheetPreload.valid() &&
+        mSheetPreload.wait_for(std::chrono::seconds(0)) !=
+            std::future_status::ready
+    ) {
+        return;
+    }
+    mSheetPreload = std::async(std::launch::async, [this, games] {
+        Profiler::SetThreadName("Loader");
+        ARC_PROFILE_ZONE("PreloadSheets");
+        AllocationTracker::Scope scope(AllocationTracker::Phase::LOADER);
+
+        for (const std::string& game : games) {
+            std::optional<ModuleDescriptor> descriptor =
+                ReadModuleDescriptor(game);
+
+            if (descriptor && descriptor->spriteSheet[0] != '\0') {
+                mAtlases.Get(descriptor->spriteSheet);
+            }
+        }
+    });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Core::OpenInputLog(void)
+{
+    const char* replay = std::getenv("ARCADE_REPLAY");
+    const char* record = std::getenv("ARCADE_RECORD");
+    std::random_device device;
+    std::uint64_t seed =
+        (static_cast<std::uint64_t>(device()) << 32) | device();
+
+    if (replay != nullptr) {
+        mInputLog.emplace(replay, InputLog::Mode::REPLAY);
+        seed = mInputLog->GetSeed();
+    } else if (record != nullptr) {
+        mInputLog.emplace(record, InputLog::Mode::RECORD, seed);
+    }
+    API::SetRandomSeed(seed);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Core::IsReplaying(void) const
+{
+    return (mInputLog && mInputLog->GetMode() == InputLog::Mode::REPLAY);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Core::PushDeviceKey(EKeyboardKey code)
+{
+    API::Event event = API::Event::KeyPressed{code};
+
+    if (mInputLog) {
+        mInputLog->GetFrame().inputs.push_back({API::Event::GAME, event});
+    }
+    API::PushEvent(API::Event::GAME, event);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Core::CaptureInputs(void)
 {
-    while (std::optional event = API::PollEvent(API::Event::CORE)) {
-        if (auto change = event->GetIf<API::Event::ChangeGraphics>()) {
-            HandleGraphicsRotation(change->delta);
-        } else if (auto change = event->GetIf<API::Event::ChangeGame>()) {
-            HandleGameRotation(change->delta);
-        } else if (event->Is<API::Event::Closed>()) {
-            mIsWindowOpen = false;
-        } else if (auto key = event->GetIf<API::Event::KeyPressed>()) {
-            HandleKeyPressed(key->code);
-        } else if (auto lib = event->GetIf<API::Event::SetGame>()) {
-            SetGame(lib->game);
-        } else if (auto lib = event->GetIf<API::Event::SetGraphics>()) {
-            SetGraphics(lib->graphical);
-        } else if (auto info = event->GetIf<API::Event::PlayerInformation>()) {
-            if (!info->username.empty()) {
-                mUserName = info->username;
+    if (!mInputLog) {
+        return;
+    }
+
+    bool replaying = IsReplaying();
+    std::vector<InputLog::Input>& inputs = mInputLog->GetFrame().inputs;
+    std::vector<API::Event> kept;
+    std::size_t first = inputs.size();
+
+    // The core channel is empty before the graphics update, and the mouse
+    // is the only input the core never forwards to the game
+    for (API::Event::Channel channel : {API::Event::CORE, API::Event::GAME}) {
+        API::DrainEvents(channel, [&](API::Event& event) {
+            bool input = channel == API::Event::CORE
+                ? InputLog::IsInput(event)
+                : event.Is<API::Event::MousePressed>();
+
+            if (!input) {
+                kept.push_back(event);
+            } else if (!replaying) {
+                inputs.push_back({channel, event});
+            } else if (event.Is<API::Event::Closed>()) {
+                // Closing the window still stops a replay
+                kept.push_back(event);
             }
-        } else if (auto over = event->GetIf<API::Event::GameOver>()) {
-            SaveScore(over->score);
+        });
+        for (const API::Event& event : kept) {
+            API::PushEvent(channel, event);
         }
+        kept.clear();
+    }
+
+    if (replaying) {
+        PushLoggedInputs(false);
+        return;
+    }
+    for (std::size_t i = first; i < inputs.size(); i++) {
+        API::PushEvent(inputs[i].channel, inputs[i].event);
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void Core::PushLoggedInputs(bool devices)
+{
+    for (const InputLog::Input& input : mInputLog->GetFrame().inputs) {
+        bool device = input.channel == API::Event::GAME &&
+            input.event.Is<API::Event::KeyPressed>();
+
+        if (device == devices) {
+            API::PushEvent(input.channel, input.event);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Core::HandleEvents(void)
+{
+    ARC_PROFILE_ZONE("Core::HandleEvents");
+
+    API::DrainEvents(API::Event::CORE, [this](API::Event& event) {
+        mScheduler.MarkActivity();
+        event.Dispatch(
+            [this](const API::Event::ChangeGraphics& change) {
+                HandleGraphicsRotation(change.delta);
+            },
+            [this](const API::Event::ChangeGame& change) {
+                HandleGameRotation(change.delta);
+            },
+            [this](const API::Event::Closed&) {
+                mIsWindowOpen = false;
+            },
+            [this](const API::Event::KeyPressed& key) {
+                HandleKeyPressed(key.code);
+            },
+            [this](const API::Event::SetGame& lib) {
+                SetGame(API::GetString(lib.game));
+            },
+            [this](const API::Event::SetGraphics& lib) {
+                SetGraphics(API::GetString(lib.graphical));
+            },
+            [this](const API::Event::PlayerInformation& info) {
+                const std::string& username = API::GetString(info.username);
+
+                if (!username.empty()) {
+                    mUserName = username;
+                    mBestScore.reset();
+                }
+            },
+            [this](const API::Event::GameOver& over) {
+                SaveScore(over.score);
+            }
+        );
+    });
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int Core::IsAxisPressed(Joystick::Axis axis)
 {
@@ -415,83 +743,56 @@ int Core::IsAxisPressed(Joystick::Axis axis)
 ///////////////////////////////////////////////////////////////////////////////
 void Core::HandleJoystick(void)
 {
+    ARC_PROFILE_ZONE("Core::HandleJoystick");
+
     if (Joystick::IsButtonPressed(0, 0)) {
-        API::PushEvent(API::Event::Channel::GAME, API::Event::KeyPressed{
-            EKeyboardKey::SPACE
-        });
+        PushDeviceKey(EKeyboardKey::SPACE);
     }
 
     if (Joystick::IsButtonPressed(0, 7)) {
-        API::PushEvent(API::Event::Channel::GAME, API::Event::KeyPressed{
-            EKeyboardKey::Q
-        });
+        PushDeviceKey(EKeyboardKey::Q);
     }
 
     if (auto delta = IsAxisPressed(Joystick::Axis::PovX)) {
-        API::PushEvent(API::Event::Channel::GAME, API::Event::KeyPressed{
-            delta < 0 ? EKeyboardKey::LEFT : EKeyboardKey::RIGHT
-        });
+        PushDeviceKey(delta < 0 ? EKeyboardKey::LEFT : EKeyboardKey::RIGHT);
     } else if (auto delta = IsAxisPressed(Joystick::Axis::X)) {
-        API::PushEvent(API::Event::Channel::GAME, API::Event::KeyPressed{
-            delta < 0 ? EKeyboardKey::LEFT : EKeyboardKey::RIGHT
-        });
+        PushDeviceKey(delta < 0 ? EKeyboardKey::LEFT : EKeyboardKey::RIGHT);
     } else if (auto delta = IsAxisPressed(Joystick::Axis::U)) {
-        API::PushEvent(API::Event::Channel::GAME, API::Event::KeyPressed{
-            delta < 0 ? EKeyboardKey::LEFT : EKeyboardKey::RIGHT
-        });
+        PushDeviceKey(delta < 0 ? EKeyboardKey::LEFT : EKeyboardKey::RIGHT);
     }
 
     if (auto delta = IsAxisPressed(Joystick::Axis::PovY)) {
-        API::PushEvent(API::Event::Channel::GAME, API::Event::KeyPressed{
-            delta < 0 ? EKeyboardKey::UP : EKeyboardKey::DOWN
-        });
+        PushDeviceKey(delta < 0 ? EKeyboardKey::UP : EKeyboardKey::DOWN);
     } else if (auto delta = IsAxisPressed(Joystick::Axis::Y)) {
-        API::PushEvent(API::Event::Channel::GAME, API::Event::KeyPressed{
-            delta < 0 ? EKeyboardKey::UP : EKeyboardKey::DOWN
-        });
+        PushDeviceKey(delta < 0 ? EKeyboardKey::UP : EKeyboardKey::DOWN);
     } else if (auto delta = IsAxisPressed(Joystick::Axis::V)) {
-        API::PushEvent(API::Event::Channel::GAME, API::Event::KeyPressed{
-            delta < 0 ? EKeyboardKey::UP : EKeyboardKey::DOWN
-        });
+        PushDeviceKey(delta < 0 ? EKeyboardKey::UP : EKeyboardKey::DOWN);
     }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void Core::HandleWiiMote(void)
 {
+    ARC_PROFILE_ZONE("Core::HandleWiiMote");
+
     WiiMote::Update();
 
     WiiMote::Accelerometer accel = WiiMote::GetAccelerometer(0);
 
     if (accel.pitch > 50) {
-        API::PushEvent(
-            API::Event::Channel::GAME,
-            API::Event::KeyPressed{EKeyboardKey::LEFT}
-        );
+        PushDeviceKey(EKeyboardKey::LEFT);
     } else if (accel.pitch < -50) {
-        API::PushEvent(
-            API::Event::Channel::GAME,
-            API::Event::KeyPressed{EKeyboardKey::RIGHT}
-        );
+        PushDeviceKey(EKeyboardKey::RIGHT);
     } else if (accel.roll > 0 && accel.roll < 50) {
-        API::PushEvent(
-            API::Event::Channel::GAME,
-            API::Event::KeyPressed{EKeyboardKey::DOWN}
-        );
+        PushDeviceKey(EKeyboardKey::DOWN);
     } else if (accel.roll < -130) {
-        API::PushEvent(
-            API::Event::Channel::GAME,
-            API::Event::KeyPressed{EKeyboardKey::UP}
-        );
+        PushDeviceKey(EKeyboardKey::UP);
     }
 
     if (WiiMote::IsButtonPressed(0, WiiMote::Button::A)) {
         if (!mButtonPressed[WiiMote::Button::A]) {
             mButtonPressed[WiiMote::Button::A] = true;
-            API::PushEvent(
-                API::Event::Channel::GAME,
-                API::Event::KeyPressed{EKeyboardKey::SPACE}
-            );
+            PushDeviceKey(EKeyboardKey::SPACE);
         }
     } else {
         mButtonPressed[WiiMote::Button::A] = false;
@@ -502,7 +803,10 @@ void Core::HandleWiiMote(void)
 void Core::RefreshLibraries(void)
 {
     mTimer = 0.f;
-    GetLibraries();
+    if (!GetLibraries()) {
+        return;
+    }
+
     std::vector<std::string> games, graphicals;
 
     for (const auto& [path, name] : mGameLibs) {
@@ -512,17 +816,14 @@ void Core::RefreshLibraries(void)
         graphicals.push_back(name);
     }
 
-    API::PushEvent(
-        API::Event::GAME,
-        API::Event::Libraries{graphicals, games}
-    );
+    API::PushEvent(API::Event::GAME, API::Event::Libraries{
+        API::InternStrings(graphicals), API::InternStrings(games)
+    });
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void Core::Run(void)
 {
-    auto start = std::chrono::high_resolution_clock::now();
-
     if (mStates.size() == 0) {
         return;
     }
@@ -532,40 +833,146 @@ void Core::Run(void)
     mGraphics->SetTitle(mStates.top()->GetName());
 
     mStates.top()->BeginPlay();
+    PreloadNeighbours();
+
+    bool replaying = IsReplaying();
+    FrameScheduler::Clock::time_point started = FrameScheduler::Clock::now();
+
     while (mIsWindowOpen && mStates.size() > 0) {
-        Joystick::Update();
+        ARC_PROFILE_ZONE("Frame");
 
-        auto end = std::chrono::high_resolution_clock::now();
-        std::chrono::duration<float> duration = end - start;
-        start = end;
+        // A replay runs the logged ticks as fast as possible
+        float deltaSeconds = replaying ? 0.f : mScheduler.BeginFrame();
 
-        float deltaSeconds = duration.count();
+        if (mInputLog && !mInputLog->BeginFrame()) {
+            break;
+        }
 
-        mTimer += deltaSeconds;
+        {
+            ARC_PROFILE_ZONE("Joystick::Update");
+            Joystick::Update();
+        }
 
-        if (mTimer >= 2.f && mStates.top()->GetName() == "MenuGUI") {
-            RefreshLibraries();
+        // Logged runs follow the simulated time, see below
+        if (!mInputLog) {
+            mTimer += deltaSeconds;
         }
 
-        if (WiiMote::IsConnected(0)) {
-            HandleWiiMote();
+        // The menu being left would not see the list, it is sent once the
+        // menu is back on top
+        if (mTimer >= 2.f && mGameName == "MenuGUI" && !mPendingGame) {
+            RefreshLibraries();
         }
 
-        if (Joystick::IsConnected(0)) {
-            HandleJoystick();
+        if (replaying) {
+            PushLoggedInputs(true);
+        } else {
+            if (WiiMote::IsConnected(0)) {
+                HandleWiiMote();
+            }
+
+            if (Joystick::IsConnected(0)) {
+                HandleJoystick();
+            }
         }
         HandleEvents();
         SendBestScore();
-        mGraphics->Update();
-        mGraphics->Clear();
-        mStates.top()->Tick(deltaSeconds);
-        mGraphics->Render();
+        {
+            ARC_PROFILE_ZONE("IGraphicsModule::Update");
+            AllocationTracker::Scope scope(
+                AllocationTracker::Phase::GRAPHICS_UPDATE
+            );
+            mGraphics->Update();
+        }
+        CaptureInputs();
+        mHud.Update();
+        UpdateGameSwitch();
+        if (API::GetInputCount() != mInputCount) {
+            mInputCount = API::GetInputCount();
+            mScheduler.MarkActivity();
+        }
+        {
+            ARC_PROFILE_ZONE("IGraphicsModule::Clear");
+            AllocationTracker::Scope scope(
+                AllocationTracker::Phase::GRAPHICS_RENDER
+            );
+            mGraphics->Clear();
+        }
+
+        std::uint32_t ticks = 0;
+        float tickDelta = replaying
+            ? mInputLog->GetFrame().tickDelta
+            : mScheduler.GetTickDelta();
+
+        while (
+            replaying
+                ? ticks < mInputLog->GetFrame().ticks && !mPendingGame
+                : mScheduler.NextTick()
+        ) {
+            // The last frame stays on screen while a game is loading
+            if (mPendingGame) {
+                continue;
+            }
+            ARC_PROFILE_ZONE("IGameModule::Tick");
+            AllocationTracker::Scope scope(
+                AllocationTracker::Phase::GAME_TICK
+            );
+
+            API::DiscardDrawCommands();
+            mStates.top()->Tick(tickDelta);
+            ticks++;
+        }
+        if (ticks > 0) {
+            mHud.Draw();
+            API::SwapDrawBuffers();
+        }
+
+        if (mInputLog) {
+            mInputLog->GetFrame().ticks = ticks;
+            mInputLog->GetFrame().tickDelta = tickDelta;
+            mTimer += ticks * tickDelta;
+            mInputLog->EndFrame();
+        }
+
+        {
+            ARC_PROFILE_ZONE("IGraphicsModule::Render");
+            AllocationTracker::Scope scope(
+                AllocationTracker::Phase::GRAPHICS_RENDER
+            );
+            mGraphics->Render();
+        }
+        if (!replaying) {
+            ARC_PROFILE_ZONE("Wait");
+            mScheduler.EndFrame();
+        }
+        Profiler::Update();
+        AllocationTracker::EndFrame();
     }
     mStates.top()->EndPlay();
 
     WiiMote::Cleanup();
 
     Audio::Shutdown();
+
+    if (mInputLog) {
+        float seconds = std::chrono::duration<float>(
+            FrameScheduler::Clock::now() - started
+        ).count();
+
+        std::cerr << (replaying ? "Replayed " : "Recorded ")
+                  << mInputLog->GetFrameIndex() << " frames in "
+                  << seconds << " s, "
+                  << mInputLog->GetFrameIndex() / std::max(seconds, 1e-6f)
+                  << " frames/s" << std::endl;
+    }
+    Profiler::Shutdown();
+    AllocationTracker::Shutdown();
+    if (mSwitchCount > 0) {
+        std::cerr << "Library switches: " << mSwitchCount
+                  << ", average " << mSwitchTotal * 1000.f / mSwitchCount
+                  << " ms, worst " << mSwitchWorst * 1000.f << " ms"
+                  << std::endl;
+    }
 }
 
 } // namespace Arc
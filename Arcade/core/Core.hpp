@@ -8,12 +8,22 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "Arcade/interfaces/IGraphicsModule.hpp"
 #include "Arcade/interfaces/IGameModule.hpp"
+#include "Arcade/core/API.hpp"
+#include "Arcade/core/AtlasCache.hpp"
+#include "Arcade/core/FrameScheduler.hpp"
+#include "Arcade/core/Hud.hpp"
+#include "Arcade/core/InputLog.hpp"
+#include "Arcade/core/LibraryRegistry.hpp"
+#include "Arcade/core/ScoreStore.hpp"
 #include "Arcade/shared/Joystick.hpp"
 #include "Arcade/shared/WiiMote.hpp"
 #include "Arcade/enums/Inputs.hpp"
+#include <future>
 #include <memory>
+#include <optional>
 #include <string>
 #include <stack>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Arc
@@ -39,16 +49,34 @@ private:
     static constexpr float MIN_GESTURE_DURATION = 0.08f;    //<!
     static constexpr float ALPHA = 0.3f;                    //<!
 
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A game library loading in background
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct PendingGame
+    {
+        std::string path;                   //<! Latest requested library
+        std::string loading;                //<! Library being loaded
+        std::future<
+            std::shared_ptr<IGameModule>
+        > module;                           //<! Constructed module
+        FrameScheduler::Clock::time_point start; //<! First request
+    };
+
 private:
     ///////////////////////////////////////////////////////////////////////////
     // Member data
     ///////////////////////////////////////////////////////////////////////////
+    AtlasCache mAtlases;                                    //<! Outlives
+    Hud mHud;                                               //<! Outlives
     std::shared_ptr<Arc::IGraphicsModule> mGraphics;        //<!
     std::stack<std::shared_ptr<Arc::IGameModule>> mStates;  //<!
     bool mIsWindowOpen;                                     //<!
     int mGraphicLibIdx{0};                                  //<!
     int mGameLibIdx{0};                                     //<!
     float mTimer;                                           //<!
+    LibraryRegistry mLibraries;                             //<!
     std::map<std::string, std::string> mGraphicLibs;        //<!
     std::map<std::string, std::string> mGameLibs;           //<!
     std::string mGraphicLib;                                //<!
@@ -58,6 +86,18 @@ private:
         WiiMote::Button, bool, WiiMote::buttonCount
     > mButtonPressed;                                       //<!
     std::string mUserName;                                  //<!
+    FrameScheduler mScheduler;                              //<!
+    std::uint64_t mInputCount;                              //<!
+    ScoreStore mScores;                                     //<!
+    std::optional<int> mBestScore;                          //<! Last sent
+    std::string mGameName;                                  //<! Top module
+    int mSwitchCount;                                       //<! Switches
+    float mSwitchTotal;                                     //<! Seconds
+    float mSwitchWorst;                                     //<! Seconds
+    std::optional<InputLog> mInputLog;                      //<! Record/replay
+    std::vector<API::Event> mHeldEvents;                    //<! While loading
+    std::optional<PendingGame> mPendingGame;                //<! Joined first
+    std::future<void> mSheetPreload;                        //<! Next sheets
 
 public:
     ///////////////////////////////////////////////////////////////////////////
@@ -70,6 +110,46 @@ public:
     Core(const std::string& graphicLib, const std::string& gameLib);
 
 private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Open the input log asked for by ARCADE_RECORD or
+    /// ARCADE_REPLAY, and seed the games from it
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void OpenInputLog(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Check if the inputs come from the input log
+    ///
+    /// \return True when replaying
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool IsReplaying(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Push a key read from a joystick or a WiiMote to the game,
+    /// recording it
+    ///
+    /// \param code The key
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void PushDeviceKey(EKeyboardKey code);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Record the inputs pushed by the graphics module this frame,
+    /// or replace them by the logged ones when replaying
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void CaptureInputs(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Push the logged inputs of the current frame
+    ///
+    /// \param devices True for the joystick and WiiMote keys, false for the
+    /// graphics module inputs
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void PushLoggedInputs(bool devices);
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -77,10 +157,12 @@ private:
     void HandleEvents(void);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Update the library lists from the registry
+    ///
+    /// \return True if the lists changed
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void GetLibraries(void);
+    bool GetLibraries(void);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -95,13 +177,28 @@ private:
     );
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Cache the name of the module on top of the stack, to call
+    /// after every push or pop
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void OnGameChanged(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Give the sprite sheet of the module on top of the stack to
+    /// the graphics module, decoded from the atlas cache when possible
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void LoadSpriteSheet(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Push the best score to the game when it changed since the
+    /// last push, reset mBestScore to push it again
     ///
     ///////////////////////////////////////////////////////////////////////////
     void SendBestScore(void);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Record the score of a finished game
     ///
     /// \param score
     ///
@@ -148,6 +245,49 @@ private:
     ///////////////////////////////////////////////////////////////////////////
     void HandleGameRotation(int delta);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Start loading a game library in background, or retarget the
+    /// load in progress
+    ///
+    /// mGameLib and mGameLibIdx are only updated once the game is committed.
+    ///
+    /// \param path The game library
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void BeginGameSwitch(const std::string& path);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Load the requested library of mPendingGame on another thread,
+    /// which opens the library, constructs the module and decodes its
+    /// sprite sheet
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void LoadPendingGame(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Hold the game inputs while a game loads, and put the new game
+    /// on top of the stack once it is ready, to call once per frame
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void UpdateGameSwitch(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Record the latency of a library switch and preload the
+    /// libraries next to the new ones
+    ///
+    /// \param start When the switch began
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void EndSwitch(FrameScheduler::Clock::time_point start);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Preload the previous and next game and graphics libraries,
+    /// so that rotating to them does not wait for dlopen, and decode the
+    /// sprite sheets of the games
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void PreloadNeighbours(void);
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -0,0 +1,58 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Arcade/core/DrawBuffer.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+DrawBuffer::DrawBuffer(std::size_t capacity)
+{
+    mCommands.reserve(capacity);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void DrawBuffer::Push(
+    SpriteHandle sprite,
+    const Vec2f& position,
+    const Color& color,
+    int id
+)
+{
+    DrawCommand& command = mCommands.emplace_back();
+
+    command.position = position;
+    command.id = id;
+    command.color = color;
+    command.sprite = sprite;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void DrawBuffer::Clear(void)
+{
+    mCommands.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Span<const DrawCommand> DrawBuffer::GetCommands(void) const
+{
+    return (Span<const DrawCommand>(mCommands.data(), mCommands.size()));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t DrawBuffer::GetSize(void) const
+{
+    return (mCommands.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t DrawBuffer::GetCapacity(void) const
+{
+    return (mCommands.capacity());
+}
+
+} // namespace Arc
@@ -0,0 +1,119 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Arcade/core/SpriteRegistry.hpp"
+#include "Arcade/utils/Color.hpp"
+#include "Arcade/utils/Span.hpp"
+#include "Arcade/utils/Vec2.hpp"
+#include <type_traits>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+//
+///////////////////////////////////////////////////////////////////////////////
+#define ARC_DRAW_BUFFER_CAPACITY    2048
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Plain draw record stored by value in the draw buffer
+///
+///////////////////////////////////////////////////////////////////////////////
+struct DrawCommand
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Member data
+    ///////////////////////////////////////////////////////////////////////////
+    Vec2f position;                         //<! Grid position
+    int id;                                 //<! Entity id, -1 if none
+    Color color;                            //<! Draw color
+    SpriteHandle sprite;                    //<! Registered sprite
+};
+
+///////////////////////////////////////////////////////////////////////////////
+//
+///////////////////////////////////////////////////////////////////////////////
+static_assert(
+    std::is_trivially_copyable_v<DrawCommand>,
+    "DrawCommand must stay trivially copyable"
+);
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Contiguous list of draw commands reusing its storage across frames
+///
+///////////////////////////////////////////////////////////////////////////////
+class DrawBuffer
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Member data
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<DrawCommand> mCommands;     //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Construct a buffer with preallocated storage
+    ///
+    /// \param capacity Number of commands to reserve up front
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    DrawBuffer(std::size_t capacity = ARC_DRAW_BUFFER_CAPACITY);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Append a draw command
+    ///
+    /// \param sprite The registered sprite to draw
+    /// \param position The grid position
+    /// \param color The draw color
+    /// \param id The entity id used for interpolation, -1 if none
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Push(
+        SpriteHandle sprite,
+        const Vec2f& position,
+        const Color& color,
+        int id
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Drop every command while keeping the allocated storage
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Clear(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return A view over the recorded commands
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Span<const DrawCommand> GetCommands(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return The number of recorded commands
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t GetSize(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return The number of commands that fit without reallocating
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t GetCapacity(void) const;
+};
+
+} // namespace Arc
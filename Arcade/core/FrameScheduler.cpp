@@ -0,0 +1,195 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Arcade/core/FrameScheduler.hpp"
+#include <algorithm>
+#include <thread>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+FrameScheduler::FrameScheduler(float tickRate, float frameRate)
+    : mTickStep(ToPeriod(tickRate))
+    , mFrameStep(ToPeriod(frameRate))
+    , mAccumulator(0)
+    , mIdleStep(ToPeriod(ARC_DEFAULT_IDLE_RATE))
+    , mIdleDelay(std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<float>(ARC_DEFAULT_IDLE_DELAY)
+    ))
+    , mLastActivity(Clock::now())
+    , mSpinMargin(ARC_MIN_SPIN_MARGIN)
+    , mElapsed(0.f)
+    , mVariableTick(false)
+    , mStarted(false)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+FrameScheduler::Clock::duration FrameScheduler::ToPeriod(float rate)
+{
+    if (rate <= 0.f) {
+        return (Clock::duration::zero());
+    }
+    return (std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<float>(1.f / rate)
+    ));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FrameScheduler::SetTickRate(float tickRate)
+{
+    mTickStep = ToPeriod(tickRate);
+    mAccumulator = Clock::duration::zero();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FrameScheduler::SetFrameRate(float frameRate)
+{
+    mFrameStep = ToPeriod(frameRate);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FrameScheduler::SetIdle(float idleRate, float idleDelay)
+{
+    mIdleStep = ToPeriod(idleRate);
+    mIdleDelay = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<float>(idleDelay)
+    );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FrameScheduler::MarkActivity(void)
+{
+    mLastActivity = Clock::now();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool FrameScheduler::IsIdle(void) const
+{
+    return (
+        mIdleDelay > Clock::duration::zero() &&
+        mIdleStep > Clock::duration::zero() &&
+        Clock::now() - mLastActivity >= mIdleDelay
+    );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+float FrameScheduler::BeginFrame(void)
+{
+    Clock::time_point now = Clock::now();
+    Clock::duration elapsed = mStarted ? now - mLastFrame : mTickStep;
+    Clock::duration limit = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<float>(ARC_MAX_FRAME_TIME)
+    );
+
+    // Idle frames may be longer than the clamp, they must not slow the games
+    limit = std::max(limit, mIdleStep);
+    if (elapsed > limit) {
+        elapsed = limit;
+    }
+    if (!mStarted) {
+        mDeadline = now;
+    }
+
+    mLastFrame = now;
+    mStarted = true;
+    mElapsed = std::chrono::duration<float>(elapsed).count();
+    mAccumulator += elapsed;
+    mVariableTick = true;
+    return (mElapsed);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool FrameScheduler::NextTick(void)
+{
+    if (mTickStep == Clock::duration::zero()) {
+        bool tick = mVariableTick;
+
+        mVariableTick = false;
+        return (tick);
+    }
+
+    if (mAccumulator < mTickStep) {
+        return (false);
+    }
+    mAccumulator -= mTickStep;
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+float FrameScheduler::GetTickDelta(void) const
+{
+    if (mTickStep == Clock::duration::zero()) {
+        return (mElapsed);
+    }
+    return (std::chrono::duration<float>(mTickStep).count());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+float FrameScheduler::GetAlpha(void) const
+{
+    if (mTickStep == Clock::duration::zero()) {
+        return (1.f);
+    }
+    return (
+        std::chrono::duration<float>(mAccumulator).count() /
+        std::chrono::duration<float>(mTickStep).count()
+    );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FrameScheduler::EndFrame(void)
+{
+    Clock::duration step = mFrameStep;
+
+    if (step == Clock::duration::zero()) {
+        step = mTickStep;
+    }
+    if (IsIdle() && mIdleStep > step) {
+        step = mIdleStep;
+    }
+    if (step == Clock::duration::zero()) {
+        return;
+    }
+
+    Clock::time_point now = Clock::now();
+
+    mDeadline += step;
+    if (mDeadline < now) {
+        // Too late for this deadline, skip it instead of rushing the next
+        // frames to catch up
+        mDeadline = now;
+        return;
+    }
+    WaitUntil(mDeadline);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FrameScheduler::WaitUntil(Clock::time_point deadline)
+{
+    Clock::time_point wake = deadline - mSpinMargin;
+
+    if (Clock::now() < wake) {
+        std::this_thread::sleep_until(wake);
+
+        // Keep the margin a little above the worst recent oversleep, and let
+        // it shrink slowly when the scheduler is punctual again
+        Clock::duration late = Clock::now() - wake;
+
+        mSpinMargin = std::max(late + late / 4, mSpinMargin * 15 / 16);
+        mSpinMargin = std::clamp(
+            mSpinMargin,
+            Clock::duration(ARC_MIN_SPIN_MARGIN),
+            Clock::duration(ARC_MAX_SPIN_MARGIN)
+        );
+    }
+
+    while (Clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+}
+
+} // namespace Arc
@@ -0,0 +1,184 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include <chrono>
+
+///////////////////////////////////////////////////////////////////////////////
+//
+///////////////////////////////////////////////////////////////////////////////
+#define ARC_DEFAULT_TICK_RATE       60.f
+#define ARC_DEFAULT_IDLE_RATE       10.f
+#define ARC_DEFAULT_IDLE_DELAY      30.f
+#define ARC_MAX_FRAME_TIME          0.25f
+#define ARC_MIN_SPIN_MARGIN         std::chrono::microseconds(200)
+#define ARC_MAX_SPIN_MARGIN         std::chrono::milliseconds(4)
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Pace the main loop: fixed simulation ticks, capped frame rate
+///
+/// Real time is added to an accumulator every frame and consumed by fixed
+/// steps, so the games advance by the same delta on every backend whatever
+/// the frame time is. Rendering happens once per frame, and the frame is
+/// held until its deadline so the loop sleeps instead of spinning: the
+/// thread sleeps until shortly before the deadline, then yields until it.
+/// The margin follows how late the sleeps wake up on this machine.
+///
+/// A tick rate of 0 falls back to one variable tick per frame. A frame rate
+/// of 0 renders at the tick rate, or without limit with variable ticks.
+///
+/// Without activity for the idle delay, frames drop to the idle rate. Ticks
+/// keep their rate, so only the refresh slows down.
+///
+///////////////////////////////////////////////////////////////////////////////
+class FrameScheduler
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    using Clock = std::chrono::steady_clock;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Member data
+    ///////////////////////////////////////////////////////////////////////////
+    Clock::duration mTickStep;              //<! Zero for variable ticks
+    Clock::duration mFrameStep;             //<! Zero without frame cap
+    Clock::duration mAccumulator;           //<! Time not simulated yet
+    Clock::time_point mLastFrame;           //<! Start of the last frame
+    Clock::time_point mDeadline;            //<! End of the current frame
+    Clock::duration mIdleStep;              //<! Frame period when idle
+    Clock::duration mIdleDelay;             //<! Zero to never idle
+    Clock::time_point mLastActivity;        //<! Last input or state change
+    Clock::duration mSpinMargin;            //<! Time spun before deadline
+    float mElapsed;                         //<! Seconds of the last frame
+    bool mVariableTick;                     //<! Variable tick not consumed
+    bool mStarted;                          //<! BeginFrame was called once
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor
+    ///
+    /// \param tickRate The simulation ticks per second, 0 for variable
+    /// \param frameRate The maximum frames per second, 0 for the default
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    FrameScheduler(
+        float tickRate = ARC_DEFAULT_TICK_RATE,
+        float frameRate = 0.f
+    );
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Change the simulation rate
+    ///
+    /// \param tickRate The ticks per second, 0 for one variable tick per
+    /// frame
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void SetTickRate(float tickRate);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Change the frame cap
+    ///
+    /// \param frameRate The maximum frames per second, 0 to follow the tick
+    /// rate
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void SetFrameRate(float frameRate);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Change the idle mode
+    ///
+    /// \param idleRate The frames per second when idle
+    /// \param idleDelay The seconds without activity before going idle, 0 to
+    /// never go idle
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void SetIdle(float idleRate, float idleDelay);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Leave the idle mode and restart the idle delay
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void MarkActivity(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Check if the frames are slowed down
+    ///
+    /// \return True if nothing happened for the idle delay
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool IsIdle(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Start a frame, adding the real time elapsed to the accumulator
+    ///
+    /// \return The seconds elapsed since the previous frame, clamped to
+    /// ARC_MAX_FRAME_TIME so a stall does not trigger a burst of ticks
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    float BeginFrame(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Consume one simulation step
+    ///
+    /// \return True while the game must be ticked again this frame
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool NextTick(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the delta to pass to IGameModule::Tick
+    ///
+    /// \return The fixed step, or the frame time with variable ticks
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    float GetTickDelta(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get how far the simulation is into the next tick
+    ///
+    /// \return The remaining accumulator over the step, from 0 to 1
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    float GetAlpha(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Sleep until the end of the frame
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void EndFrame(void);
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Sleep then spin until a time point
+    ///
+    /// \param deadline The time point
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void WaitUntil(Clock::time_point deadline);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Convert a rate to a period
+    ///
+    /// \param rate The rate in hertz
+    ///
+    /// \return The period, zero if the rate is not positive
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static Clock::duration ToPeriod(float rate);
+};
+
+} // namespace Arc
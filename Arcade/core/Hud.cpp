@@ -0,0 +1,354 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Arcade/core/Hud.hpp"
+#include "Arcade/core/Profiler.hpp"
+#include "Arcade/audio/Audio.hpp"
+#include "Arcade/interfaces/IGraphicsModule.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fcntl.h>
+#include <unistd.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Rows of the ARC_HUD_GLYPHS characters, 5 pixels wide and 7 high,
+/// the leftmost pixel in the highest bit
+///
+///////////////////////////////////////////////////////////////////////////////
+static const std::uint8_t FONT[][7] = {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},     // ' '
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C},     // '.'
+    {0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E},     // '0'
+    {0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E},     // '1'
+    {0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F},     // '2'
+    {0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E},     // '3'
+    {0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02},     // '4'
+    {0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E},     // '5'
+    {0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E},     // '6'
+    {0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08},     // '7'
+    {0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E},     // '8'
+    {0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C},     // '9'
+    {0x0E, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11},     // 'A'
+    {0x1E, 0x11, 0x11, 0x1E, 0x11, 0x11, 0x1E},     // 'B'
+    {0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E},     // 'C'
+    {0x1C, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1C},     // 'D'
+    {0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F},     // 'E'
+    {0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10},     // 'F'
+    {0x0E, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0F},     // 'G'
+    {0x11, 0x1B, 0x15, 0x15, 0x11, 0x11, 0x11},     // 'M'
+    {0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11},     // 'N'
+    {0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10},     // 'P'
+    {0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11},     // 'R'
+    {0x0F, 0x10, 0x10, 0x0E, 0x01, 0x01, 0x1E},     // 'S'
+    {0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x04},     // 'V'
+    {0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0A},     // 'W'
+    {0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11}      // 'X'
+};
+
+///////////////////////////////////////////////////////////////////////////////
+static_assert(
+    sizeof(FONT) / sizeof(FONT[0]) == sizeof(ARC_HUD_GLYPHS) - 1,
+    "Every HUD glyph needs its rows"
+);
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Text-mode glyphs of the sparkline bars, lowest first
+///
+///////////////////////////////////////////////////////////////////////////////
+static const char* const BARS[ARC_HUD_BAR_COUNT] = {
+    "\xe2\x96\x81", "\xe2\x96\x82", "\xe2\x96\x83", "\xe2\x96\x84",
+    "\xe2\x96\x85", "\xe2\x96\x86", "\xe2\x96\x87", "\xe2\x96\x88"
+};
+
+///////////////////////////////////////////////////////////////////////////////
+static const Color TEXT_COLOR = {255, 255, 255};
+static const Color BAR_COLOR = {0, 255, 0};
+static const Color PANEL_COLOR = {0, 0, 0};
+
+///////////////////////////////////////////////////////////////////////////////
+Hud::Hud(bool enabled)
+    : mEnabled(enabled)
+    , mReady(false)
+    , mSource{nullptr, 0, 0}
+    , mGlyphs{}
+{
+    Reset();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Hud::SetEnabled(bool enabled)
+{
+    if (enabled && !mEnabled) {
+        Reset();
+    }
+    mEnabled = enabled;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Hud::IsEnabled(void) const
+{
+    return (mEnabled);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+PixelView Hud::ComposeSheet(const PixelView& sheet)
+{
+    const unsigned int tile = IGraphicsModule::GRID_TILE_SIZE;
+    unsigned int columns = sheet.width / tile;
+
+    if (!mEnabled || columns == 0) {
+        mReady = false;
+        return (sheet);
+    }
+
+    unsigned int top = (sheet.height + tile - 1) / tile;
+    unsigned int rows = (GLYPH_COUNT + columns - 1) / columns;
+    PixelView composed = {nullptr, sheet.width, (top + rows) * tile};
+
+    if (
+        mReady && mSource.pixels == sheet.pixels &&
+        mSource.width == sheet.width && mSource.height == sheet.height
+    ) {
+        composed.pixels = mPixels.data();
+        return (composed);
+    }
+
+    std::size_t stride = static_cast<std::size_t>(sheet.width) * 4;
+
+    mPixels.assign(stride * composed.height, 0);
+    std::copy(
+        sheet.pixels,
+        sheet.pixels + stride * sheet.height,
+        mPixels.begin()
+    );
+    for (int i = 0; i < GLYPH_COUNT; i++) {
+        unsigned int cellX = i % columns;
+        unsigned int cellY = top + i / columns;
+
+        for (unsigned int y = 0; y < tile; y++) {
+            for (unsigned int x = 0; x < tile; x++) {
+                bool set;
+
+                if (i < BAR_OFFSET) {
+                    set = x >= 1 && x <= 5 && y < 7 &&
+                        (FONT[i][y] >> (5 - x)) & 1;
+                } else if (i < PANEL_OFFSET) {
+                    set = x >= 1 && x + 1 < tile &&
+                        y + (i - BAR_OFFSET) + 1 >= tile;
+                } else {
+                    set = true;
+                }
+                if (!set) {
+                    continue;
+                }
+
+                std::uint8_t* pixel = mPixels.data() +
+                    (cellY * tile + y) * stride + (cellX * tile + x) * 4;
+                std::uint8_t value = i < PANEL_OFFSET ? 255 : 0;
+
+                pixel[0] = value;
+                pixel[1] = value;
+                pixel[2] = value;
+                pixel[3] = 255;
+            }
+        }
+
+        std::string glyph = " ";
+        Color color = PANEL_COLOR;
+
+        if (i < BAR_OFFSET) {
+            glyph = std::string(1, ARC_HUD_GLYPHS[i]);
+            color = TEXT_COLOR;
+        } else if (i < PANEL_OFFSET) {
+            glyph = BARS[i - BAR_OFFSET];
+            color = BAR_COLOR;
+        }
+        mGlyphs[i] = API::RegisterSprite(IGameModule::Asset(
+            {static_cast<int>(cellX), static_cast<int>(cellY)},
+            glyph,
+            color,
+            {static_cast<int>(tile), static_cast<int>(tile)}
+        ));
+    }
+    mSource = sheet;
+    mReady = true;
+    composed.pixels = mPixels.data();
+    return (composed);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Hud::ResetSheet(void)
+{
+    mReady = false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Hud::Update(void)
+{
+    if (!mEnabled) {
+        return;
+    }
+
+    Clock::time_point now = Clock::now();
+    float frame = std::chrono::duration<float>(now - mLastFrame).count();
+
+    mLastFrame = now;
+    mWindowTime += frame;
+    mWindowWorst = std::max(mWindowWorst, frame);
+    mWindowFrames++;
+    for (int i = 0; i < API::Event::CHANNEL_COUNT; i++) {
+        mWindowEvents[i] = std::max(
+            mWindowEvents[i],
+            API::GetEventCount(static_cast<API::Event::Channel>(i))
+        );
+    }
+    if (mWindowTime < ARC_HUD_WINDOW) {
+        return;
+    }
+
+    mFps = mWindowFrames / mWindowTime;
+    mFrameTime = mWindowTime / mWindowFrames;
+    mHistory[mHistoryIndex] = mWindowWorst;
+    mHistoryIndex = (mHistoryIndex + 1) % ARC_HUD_WIDTH;
+    for (int i = 0; i < API::Event::CHANNEL_COUNT; i++) {
+        mEvents[i] = mWindowEvents[i];
+        mWindowEvents[i] = 0;
+    }
+    mVoices = Audio::GetActiveCount();
+    mResident = ReadResident();
+    mWindowTime = 0.f;
+    mWindowWorst = 0.f;
+    mWindowFrames = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Hud::Draw(void) const
+{
+    if (!mEnabled || !mReady) {
+        return;
+    }
+    ARC_PROFILE_ZONE("Hud::Draw");
+
+    // Read before the overlay adds its own commands
+    std::size_t draws = API::GetDrawCount();
+    float worst = *std::max_element(mHistory.begin(), mHistory.end());
+    char line[32];
+
+    for (int y = 0; y < ARC_HUD_HEIGHT; y++) {
+        for (int x = 0; x < ARC_HUD_WIDTH; x++) {
+            API::Draw(mGlyphs[PANEL_OFFSET], Vec2i{x, y}, PANEL_COLOR);
+        }
+    }
+
+    std::snprintf(line, sizeof(line), "FPS %.1f %.1fMS",
+        mFps, mFrameTime * 1000.f);
+    Text(line, 0);
+
+    for (int x = 0; x < ARC_HUD_WIDTH && worst > 0.f; x++) {
+        float frame = mHistory[(mHistoryIndex + x) % ARC_HUD_WIDTH];
+        int level = static_cast<int>(
+            std::ceil(frame / worst * ARC_HUD_BAR_COUNT)
+        );
+
+        if (level <= 0) {
+            continue;
+        }
+        API::Draw(
+            mGlyphs[BAR_OFFSET + std::min(level, ARC_HUD_BAR_COUNT) - 1],
+            Vec2i{x, 1},
+            BAR_COLOR
+        );
+    }
+
+    std::snprintf(line, sizeof(line), "MAX %.1fMS", worst * 1000.f);
+    Text(line, 2);
+    std::snprintf(line, sizeof(line), "DRAW %zu", draws);
+    Text(line, 3);
+    std::snprintf(line, sizeof(line), "EV G%zu R%zu C%zu",
+        mEvents[API::Event::GAME],
+        mEvents[API::Event::GRAPHICS],
+        mEvents[API::Event::CORE]);
+    Text(line, 4);
+    std::snprintf(line, sizeof(line), "SND %zu", mVoices);
+    Text(line, 5);
+    std::snprintf(line, sizeof(line), "RSS %.1fMB",
+        mResident / (1024.f * 1024.f));
+    Text(line, 6);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Hud::Reset(void)
+{
+    mLastFrame = Clock::now();
+    mWindowTime = 0.f;
+    mWindowWorst = 0.f;
+    mWindowFrames = 0;
+    mHistory.fill(0.f);
+    mHistoryIndex = 0;
+    mFps = 0.f;
+    mFrameTime = 0.f;
+    for (int i = 0; i < API::Event::CHANNEL_COUNT; i++) {
+        mWindowEvents[i] = 0;
+        mEvents[i] = 0;
+    }
+    mVoices = Audio::GetActiveCount();
+    mResident = ReadResident();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Hud::Text(std::string_view text, int row) const
+{
+    std::string_view glyphs = ARC_HUD_GLYPHS;
+    std::size_t length = std::min<std::size_t>(text.size(), ARC_HUD_WIDTH);
+
+    for (std::size_t i = 0; i < length; i++) {
+        std::size_t index = glyphs.find(text[i]);
+
+        if (index == std::string_view::npos || text[i] == ' ') {
+            continue;
+        }
+        API::Draw(
+            mGlyphs[index],
+            Vec2i{static_cast<int>(i), row},
+            TEXT_COLOR
+        );
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t Hud::ReadResident(void)
+{
+    int fd = open("/proc/self/statm", O_RDONLY);
+    char buffer[128];
+
+    if (fd < 0) {
+        return (0);
+    }
+
+    ssize_t length = read(fd, buffer, sizeof(buffer) - 1);
+
+    close(fd);
+    if (length <= 0) {
+        return (0);
+    }
+    buffer[length] = '\0';
+
+    // The second field is the resident set, in pages
+    char* end = nullptr;
+
+    std::strtoull(buffer, &end, 10);
+
+    unsigned long long pages = std::strtoull(end, nullptr, 10);
+
+    return (static_cast<std::size_t>(pages * sysconf(_SC_PAGESIZE)));
+}
+
+} // namespace Arc
@@ -0,0 +1,171 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Arcade/core/API.hpp"
+#include "Arcade/utils/PixelView.hpp"
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+//
+///////////////////////////////////////////////////////////////////////////////
+#define ARC_HUD_WIDTH               16
+#define ARC_HUD_HEIGHT              7
+#define ARC_HUD_WINDOW              0.25f
+#define ARC_HUD_GLYPHS              " .0123456789ABCDEFGMNPRSVWX"
+#define ARC_HUD_BAR_COUNT           8
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Performance overlay drawn by the core on top of the game
+///
+/// The overlay is made of regular draw commands, so every backend shows it,
+/// text ones included. Its font is built in: it is added in a strip under
+/// the sprite sheet of the game before the sheet reaches the backend.
+///
+/// The statistics are gathered over windows of ARC_HUD_WINDOW seconds: the
+/// frame rate and mean frame time of the last window, the worst frame of
+/// the last ARC_HUD_WIDTH windows as a sparkline, the game draw commands
+/// of the frame, the peak of queued events per channel, the playing sounds
+/// and the resident memory. Nothing is allocated once the sheet is built.
+///
+///////////////////////////////////////////////////////////////////////////////
+class Hud
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    using Clock = std::chrono::steady_clock;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr int TEXT_COUNT = sizeof(ARC_HUD_GLYPHS) - 1;
+    static constexpr int BAR_OFFSET = TEXT_COUNT;
+    static constexpr int PANEL_OFFSET = BAR_OFFSET + ARC_HUD_BAR_COUNT;
+    static constexpr int GLYPH_COUNT = PANEL_OFFSET + 1;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Member data
+    ///////////////////////////////////////////////////////////////////////////
+    bool mEnabled;                                  //<! Drawn and sampled
+    bool mReady;                                    //<! Font in the sheet
+    std::vector<std::uint8_t> mPixels;              //<! Sheet with the font
+    PixelView mSource;                              //<! Sheet it comes from
+    std::array<SpriteHandle, GLYPH_COUNT> mGlyphs;  //<! Registered font
+    Clock::time_point mLastFrame;                   //<! Of the last Update
+    float mWindowTime;                              //<! Seconds so far
+    float mWindowWorst;                             //<! Worst frame so far
+    int mWindowFrames;                              //<! Frames so far
+    std::size_t mWindowEvents[API::Event::CHANNEL_COUNT]; //<! Peaks
+    std::array<float, ARC_HUD_WIDTH> mHistory;      //<! Worst frames
+    int mHistoryIndex;                              //<! Oldest window
+    float mFps;                                     //<! Of the last window
+    float mFrameTime;                               //<! Mean, in seconds
+    std::size_t mEvents[API::Event::CHANNEL_COUNT]; //<! Peaks, last window
+    std::size_t mVoices;                            //<! Playing sounds
+    std::size_t mResident;                          //<! Resident bytes
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor
+    ///
+    /// \param enabled Whether the overlay starts shown
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit Hud(bool enabled = false);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Show or hide the overlay
+    ///
+    /// Once shown, the sprite sheet must be loaded again through
+    /// ComposeSheet for the font to be available.
+    ///
+    /// \param enabled True to show it
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void SetEnabled(bool enabled);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Check if the overlay is shown
+    ///
+    /// \return True when shown
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool IsEnabled(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Add the font under a sprite sheet and register its glyphs
+    ///
+    /// The returned view stays valid until the next call. A hidden overlay
+    /// returns the sheet unchanged.
+    ///
+    /// \param sheet The sprite sheet of the game
+    ///
+    /// \return The sheet to give to the graphics module
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    PixelView ComposeSheet(const PixelView& sheet);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Forget the font, when the backend decoded the sheet itself
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void ResetSheet(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Sample the statistics of a frame, once per frame
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Update(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Record the overlay in the back draw buffer, after the ticks
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Draw(void) const;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Start a new set of windows
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Reset(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Draw a line of text, the characters out of the font are
+    /// skipped
+    ///
+    /// \param text The text, cut to the overlay width
+    /// \param row The row of the overlay
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Text(std::string_view text, int row) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the resident memory of the process
+    ///
+    /// \return Bytes, 0 if unknown
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static std::size_t ReadResident(void);
+};
+
+} // namespace Arc
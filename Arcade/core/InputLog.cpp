@@ -0,0 +1,387 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Arcade/core/InputLog.hpp"
+#include "Arcade/errors/Exception.hpp"
+#include "Arcade/utils/BinaryIO.hpp"
+#include <cstring>
+#include <iostream>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Flags of a record
+///
+///////////////////////////////////////////////////////////////////////////////
+enum RecordFlag : std::uint8_t
+{
+    RECORD_TICKS = 1 << 0,
+    RECORD_TICK_DELTA = 1 << 1,
+    RECORD_INPUTS = 1 << 2,
+    RECORD_END = 1 << 3
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Kinds of input, in the low bits of an input byte
+///
+///////////////////////////////////////////////////////////////////////////////
+enum InputKind : std::uint8_t
+{
+    INPUT_KEY,
+    INPUT_MOUSE,
+    INPUT_CLOSED
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Read an unsigned LEB128 value
+///
+/// \param file The input file
+/// \param value The value to fill
+///
+/// \return True if the value was read completely
+///
+///////////////////////////////////////////////////////////////////////////////
+static bool ReadVarint(std::ifstream& file, std::uint64_t& value)
+{
+    std::uint8_t byte = 0x80;
+
+    value = 0;
+    for (int shift = 0; shift < 64 && (byte & 0x80); shift += 7) {
+        if (!ReadValue(file, byte)) {
+            return (false);
+        }
+        value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+    }
+    return (!(byte & 0x80));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Append an unsigned LEB128 value
+///
+/// \param buffer The output bytes
+/// \param value The value to append
+///
+///////////////////////////////////////////////////////////////////////////////
+static void WriteVarint(std::vector<char>& buffer, std::uint64_t value)
+{
+    while (value >= 0x80) {
+        buffer.push_back(static_cast<char>((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back(static_cast<char>(value));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Read a zigzag encoded coordinate
+///
+/// \param file The input file
+/// \param value The value to fill
+///
+/// \return True if the value was read completely
+///
+///////////////////////////////////////////////////////////////////////////////
+static bool ReadCoordinate(std::ifstream& file, int& value)
+{
+    std::uint64_t zigzag;
+
+    if (!ReadVarint(file, zigzag)) {
+        return (false);
+    }
+    value = static_cast<int>(
+        static_cast<std::int64_t>(zigzag >> 1) ^ -static_cast<std::int64_t>(
+            zigzag & 1
+        )
+    );
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Append a zigzag encoded coordinate, small negative values stay
+/// one byte long
+///
+/// \param buffer The output bytes
+/// \param value The value to append
+///
+///////////////////////////////////////////////////////////////////////////////
+static void WriteCoordinate(std::vector<char>& buffer, int value)
+{
+    std::int64_t wide = value;
+
+    WriteVarint(
+        buffer, static_cast<std::uint64_t>((wide << 1) ^ (wide >> 63))
+    );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+InputLog::InputLog(const std::string& path, Mode mode, std::uint64_t seed)
+    : mMode(mode)
+    , mPath(path)
+    , mSeed(seed)
+    , mFrame(0)
+    , mCurrent{0, 0.f, {}}
+    , mTicks(0)
+    , mTickDelta(0.f)
+    , mRecordFrame(0)
+    , mNextFrame(0)
+    , mNextFlags(0)
+    , mNext{0, 0.f, {}}
+{
+    if (mMode == Mode::RECORD) {
+        mOutput.open(path, std::ios::binary | std::ios::trunc);
+        if (!mOutput) {
+            throw Exception("Cannot write input log " + path);
+        }
+        mBuffer.insert(
+            mBuffer.end(), ARC_INPUT_LOG_MAGIC, ARC_INPUT_LOG_MAGIC + 4
+        );
+        WriteValue<std::uint8_t>(mBuffer, ARC_INPUT_LOG_VERSION);
+        WriteValue(mBuffer, mSeed);
+        return;
+    }
+
+    mInput.open(path, std::ios::binary);
+    if (!mInput) {
+        throw Exception("Cannot read input log " + path);
+    }
+
+    char magic[4];
+    std::uint8_t version;
+
+    mInput.read(magic, sizeof(magic));
+    if (
+        mInput.gcount() != sizeof(magic) ||
+        std::memcmp(magic, ARC_INPUT_LOG_MAGIC, sizeof(magic)) != 0 ||
+        !ReadValue(mInput, version) ||
+        version != ARC_INPUT_LOG_VERSION ||
+        !ReadValue(mInput, mSeed)
+    ) {
+        throw Exception(path + " is not an input log");
+    }
+    ReadRecord();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+InputLog::~InputLog()
+{
+    if (mMode != Mode::RECORD) {
+        return;
+    }
+    WriteRecord(RECORD_END);
+    mOutput.write(mBuffer.data(), mBuffer.size());
+    mOutput.close();
+    if (!mOutput) {
+        std::cerr << "Failed to write input log " << mPath << std::endl;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+InputLog::Mode InputLog::GetMode(void) const
+{
+    return (mMode);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t InputLog::GetSeed(void) const
+{
+    return (mSeed);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t InputLog::GetFrameIndex(void) const
+{
+    return (mFrame);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool InputLog::BeginFrame(void)
+{
+    mCurrent.inputs.clear();
+    if (mMode == Mode::RECORD) {
+        return (true);
+    }
+
+    if ((mNextFlags & RECORD_END) && mFrame >= mNextFrame) {
+        return (false);
+    }
+    if (mFrame == mNextFrame) {
+        if (mNextFlags & RECORD_TICKS) {
+            mTicks = mNext.ticks;
+        }
+        if (mNextFlags & RECORD_TICK_DELTA) {
+            mTickDelta = mNext.tickDelta;
+        }
+        mCurrent.inputs.swap(mNext.inputs);
+        mRecordFrame = mFrame;
+        ReadRecord();
+    }
+    mCurrent.ticks = mTicks;
+    mCurrent.tickDelta = mTickDelta;
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+InputLog::Frame& InputLog::GetFrame(void)
+{
+    return (mCurrent);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void InputLog::EndFrame(void)
+{
+    if (mMode == Mode::RECORD) {
+        std::uint8_t flags = 0;
+
+        if (mCurrent.ticks != mTicks) {
+            flags |= RECORD_TICKS;
+        }
+        if (mCurrent.tickDelta != mTickDelta) {
+            flags |= RECORD_TICK_DELTA;
+        }
+        if (!mCurrent.inputs.empty()) {
+            flags |= RECORD_INPUTS;
+        }
+        if (flags != 0) {
+            WriteRecord(flags);
+        }
+        if (mBuffer.size() >= 4096) {
+            Flush();
+        }
+    }
+    mFrame++;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool InputLog::IsInput(const API::Event& event)
+{
+    return (
+        event.Is<API::Event::KeyPressed>() ||
+        event.Is<API::Event::MousePressed>() ||
+        event.Is<API::Event::Closed>()
+    );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void InputLog::ReadRecord(void)
+{
+    std::uint64_t delta = 0;
+    std::uint64_t count = 0;
+
+    mNext.inputs.clear();
+    // A log cut before its end record, by a crash, ends where it was cut
+    bool complete = ReadVarint(mInput, delta) &&
+        ReadValue(mInput, mNextFlags);
+    std::uint64_t ticks = 0;
+
+    mNextFrame = mRecordFrame + delta;
+
+    if (complete && (mNextFlags & RECORD_TICKS)) {
+        complete = ReadVarint(mInput, ticks);
+        mNext.ticks = static_cast<std::uint32_t>(ticks);
+    }
+    if (complete && (mNextFlags & RECORD_TICK_DELTA)) {
+        complete = ReadValue(mInput, mNext.tickDelta);
+    }
+    if (complete && (mNextFlags & RECORD_INPUTS)) {
+        complete = ReadVarint(mInput, count);
+        for (std::uint64_t i = 0; complete && i < count; i++) {
+            std::uint8_t head, value;
+
+            complete = ReadValue(mInput, head);
+            if (!complete) {
+                break;
+            }
+            if ((head >> 2) >= API::Event::CHANNEL_COUNT || (head & 3) > 2) {
+                throw Exception(mPath + " is a corrupted input log");
+            }
+
+            Input input{
+                static_cast<API::Event::Channel>(head >> 2),
+                API::Event::Closed()
+            };
+
+            switch (head & 3) {
+                case INPUT_KEY:
+                    complete = ReadValue(mInput, value);
+                    input.event = API::Event::KeyPressed{
+                        static_cast<EKeyboardKey>(value)
+                    };
+                    break;
+                case INPUT_MOUSE:
+                {
+                    API::Event::MousePressed mouse;
+
+                    complete = ReadValue(mInput, value) &&
+                        ReadCoordinate(mInput, mouse.x) &&
+                        ReadCoordinate(mInput, mouse.y);
+                    mouse.button = static_cast<EMouseButton>(value);
+                    input.event = mouse;
+                    break;
+                }
+                default:
+                    break;
+            }
+            mNext.inputs.push_back(input);
+        }
+    }
+    if (!complete) {
+        mNext.inputs.clear();
+        mNextFrame = mRecordFrame;
+        mNextFlags = RECORD_END;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void InputLog::WriteRecord(std::uint8_t flags)
+{
+    WriteVarint(mBuffer, mFrame - mRecordFrame);
+    WriteValue(mBuffer, flags);
+    if (flags & RECORD_TICKS) {
+        WriteVarint(mBuffer, mCurrent.ticks);
+    }
+    if (flags & RECORD_TICK_DELTA) {
+        WriteValue(mBuffer, mCurrent.tickDelta);
+    }
+    if (flags & RECORD_INPUTS) {
+        WriteVarint(mBuffer, mCurrent.inputs.size());
+        for (const Input& input : mCurrent.inputs) {
+            WriteInput(input);
+        }
+    }
+    mRecordFrame = mFrame;
+    mTicks = mCurrent.ticks;
+    mTickDelta = mCurrent.tickDelta;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void InputLog::WriteInput(const Input& input)
+{
+    std::uint8_t channel = static_cast<std::uint8_t>(input.channel << 2);
+
+    if (auto key = input.event.GetIf<API::Event::KeyPressed>()) {
+        WriteValue<std::uint8_t>(mBuffer, channel | INPUT_KEY);
+        WriteValue(mBuffer, static_cast<std::uint8_t>(key->code));
+    } else if (auto mouse = input.event.GetIf<API::Event::MousePressed>()) {
+        WriteValue<std::uint8_t>(mBuffer, channel | INPUT_MOUSE);
+        WriteValue(mBuffer, static_cast<std::uint8_t>(mouse->button));
+        WriteCoordinate(mBuffer, mouse->x);
+        WriteCoordinate(mBuffer, mouse->y);
+    } else {
+        WriteValue<std::uint8_t>(mBuffer, channel | INPUT_CLOSED);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void InputLog::Flush(void)
+{
+    mOutput.write(mBuffer.data(), mBuffer.size());
+    mBuffer.clear();
+    if (!mOutput) {
+        throw Exception("Failed to write input log " + mPath);
+    }
+}
+
+} // namespace Arc
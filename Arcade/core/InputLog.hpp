@@ -0,0 +1,201 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Arcade/core/API.hpp"
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+//
+///////////////////////////////////////////////////////////////////////////////
+#define ARC_INPUT_LOG_MAGIC         "ARCR"
+#define ARC_INPUT_LOG_VERSION       1
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Inputs of a run, frame by frame, to replay it identically
+///
+/// Each frame holds the inputs that entered the core and the ticks it ran.
+/// Only the frames that differ from the previous one are stored:
+///
+/// "ARCR", u8 version, u64 random seed, then records of a varint frame
+/// delta and u8 flags, followed by a varint tick count, an f32 tick delta
+/// and a varint input count with the inputs, each only when its flag is
+/// set. A record with the end flag closes the log. An input is a u8 with
+/// its kind and channel, then a u8 key, or a u8 button and two zigzag
+/// varint coordinates. Values are in host byte order.
+///
+/// Errors throw an Exception, a truncated log ends at its last record.
+///
+///////////////////////////////////////////////////////////////////////////////
+class InputLog
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Direction of the log
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    enum class Mode
+    {
+        RECORD,
+        REPLAY
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief An input, with the channel it was pushed on
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Input
+    {
+        API::Event::Channel channel;            //<! GAME or CORE
+        API::Event event;                       //<! Key, mouse or close
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Everything the core needs to run a frame again
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Frame
+    {
+        std::uint32_t ticks;                    //<! Game ticks run
+        float tickDelta;                        //<! Given to each tick
+        std::vector<Input> inputs;              //<! In push order
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Member data
+    ///////////////////////////////////////////////////////////////////////////
+    Mode mMode;                                 //<! Record or replay
+    std::string mPath;                          //<! For the messages
+    std::ofstream mOutput;                      //<! When recording
+    std::ifstream mInput;                       //<! When replaying
+    std::uint64_t mSeed;                        //<! Of API::NextRandomSeed
+    std::uint64_t mFrame;                       //<! Current frame index
+    Frame mCurrent;                             //<! Current frame
+    std::uint32_t mTicks;                       //<! Of the last record
+    float mTickDelta;                           //<! Of the last record
+    std::uint64_t mRecordFrame;                 //<! Of the last record
+    std::uint64_t mNextFrame;                   //<! Of the record read
+    std::uint8_t mNextFlags;                    //<! Of the record read
+    Frame mNext;                                //<! Record read ahead
+    std::vector<char> mBuffer;                  //<! Pending output
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Open a log
+    ///
+    /// \param path The log file
+    /// \param mode Whether to write or read it
+    /// \param seed The seed to store when recording, read from the file
+    /// when replaying
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    InputLog(const std::string& path, Mode mode, std::uint64_t seed = 0);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Destructor, closes a recorded log
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ~InputLog();
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the direction of the log
+    ///
+    /// \return The mode
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Mode GetMode(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the random seed of the run
+    ///
+    /// \return The seed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::uint64_t GetSeed(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the index of the current frame
+    ///
+    /// \return The frame count before this one
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::uint64_t GetFrameIndex(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Start a frame, reading it when replaying
+    ///
+    /// \return False when the replayed log has no frame left
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool BeginFrame(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the current frame, filled by the core when recording
+    ///
+    /// \return The frame
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Frame& GetFrame(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief End a frame, writing it when recording
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void EndFrame(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Check if an event is an input stored in the logs
+    ///
+    /// \param event The event
+    ///
+    /// \return True for key presses, mouse presses and window closes
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static bool IsInput(const API::Event& event);
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Read the next record in mNext
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void ReadRecord(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Append a record to mBuffer
+    ///
+    /// \param flags The record flags
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void WriteRecord(std::uint8_t flags);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Append an input to mBuffer
+    ///
+    /// \param input The input
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void WriteInput(const Input& input);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Write mBuffer to the file
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Flush(void);
+};
+
+} // namespace Arc
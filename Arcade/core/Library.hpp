@@ -45,6 +45,18 @@ public:
     template <typename T>
     static std::optional<std::string> Is(const std::string& path);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Open a library in background, so a later Load only
+    /// constructs the object
+    ///
+    /// \tparam T
+    ///
+    /// \param path
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    static void Preload(const std::string& path);
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -7,10 +7,11 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "Arcade/core/Library.hpp"
+#include "Arcade/core/ModuleDescriptor.hpp"
+#include "Arcade/core/ModulePool.hpp"
 #include "Arcade/errors/DLError.hpp"
 #include <dlfcn.h>
 #include <iostream>
-#include <unordered_map>
 #include "Arcade/interfaces/IGameModule.hpp"
 #include "Arcade/interfaces/IGraphicsModule.hpp"
 #include <type_traits>
@@ -21,19 +22,12 @@
 namespace Arc
 {
 
-///////////////////////////////////////////////////////////////////////////////
-// Static map to store handles
-///////////////////////////////////////////////////////////////////////////////
-static std::unordered_map<void*, void*> s_handles;
-
 ///////////////////////////////////////////////////////////////////////////////
 template <typename T>
 std::shared_ptr<T> Library::Load(const std::string& path)
 {
-    void* handle = dlopen(path.c_str(), RTLD_LAZY);
-    if (!handle) {
-        throw DLError(dlerror());
-    }
+    ModulePool& pool = ModulePool::GetInstance();
+    void* handle = pool.Acquire(path);
 
     dlerror();
 
@@ -43,34 +37,59 @@ std::shared_ptr<T> Library::Load(const std::string& path)
 
     const char* dlsym_error = dlerror();
     if (dlsym_error) {
-        throw DLError(dlerror());
+        std::string message = dlsym_error;
+
+        pool.Release(handle);
+        throw DLError(message);
     }
 
     std::unique_ptr<T> obj = createFunc();
     if (!obj) {
-        throw DLError(dlerror());
+        pool.Release(handle);
+        throw DLError("CreateArcadeObject failed in " + path);
     }
 
-    T* raw_ptr = obj.get();
-
     std::shared_ptr<T> shared_obj(
         obj.release(),
-        [handle, raw_ptr](T* ptr) {
-            s_handles.erase(raw_ptr);
+        [handle](T* ptr) {
             delete ptr;
-            dlclose(handle);
+            ModulePool::GetInstance().Release(handle);
         }
     );
 
-    s_handles[raw_ptr] = handle;
-
     return (shared_obj);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void Library::Preload(const std::string& path)
+{
+    static_assert(
+        std::is_base_of<IGameModule, T>::value ||
+        std::is_base_of<IGraphicsModule, T>::value,
+        "Invalid module type"
+    );
+    ModulePool::GetInstance().Preload(path);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename T>
 std::optional<std::string> Library::Is(const std::string& path)
 {
+    // Modules with a descriptor are identified without being loaded
+    if (auto descriptor = ReadModuleDescriptor(path)) {
+        ModuleKind kind = std::is_base_of<IGameModule, T>::value ?
+            MODULE_GAME : MODULE_GRAPHICS;
+
+        if (
+            descriptor->kind != kind ||
+            (descriptor->flags & ARC_MODULE_HIDDEN) != 0
+        ) {
+            return (std::nullopt);
+        }
+        return (std::string(descriptor->name));
+    }
+
     void* handle = dlopen(path.c_str(), RTLD_LAZY);
 
     if (!handle) {
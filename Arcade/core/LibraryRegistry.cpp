@@ -0,0 +1,197 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Arcade/core/LibraryRegistry.hpp"
+#include "Arcade/core/Library.hpp"
+#include <cerrno>
+#include <filesystem>
+#include <iostream>
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward namespace std::filesystem
+///////////////////////////////////////////////////////////////////////////////
+namespace fs = std::filesystem;
+
+///////////////////////////////////////////////////////////////////////////////
+//
+///////////////////////////////////////////////////////////////////////////////
+#define ARC_LIBRARY_EVENTS  (IN_CREATE | IN_DELETE | IN_CLOSE_WRITE | \
+                            IN_MOVED_TO | IN_MOVED_FROM | IN_ATTRIB | \
+                            IN_DELETE_SELF | IN_MOVE_SELF)
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+LibraryRegistry::LibraryRegistry(const std::string& directory)
+    : mDirectory(directory)
+    , mNotify(inotify_init1(IN_NONBLOCK | IN_CLOEXEC))
+    , mWatch(-1)
+    , mDirectoryInode(0)
+    , mStale(true)
+{
+    if (mNotify < 0) {
+        std::cerr << "inotify unavailable, " << mDirectory
+                  << " will be listed on every refresh" << std::endl;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+LibraryRegistry::~LibraryRegistry()
+{
+    if (mNotify >= 0) {
+        close(mNotify);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool LibraryRegistry::Watch(void)
+{
+    struct stat info;
+
+    if (mNotify < 0) {
+        return (true);
+    }
+    if (stat(mDirectory.c_str(), &info) != 0) {
+        info.st_ino = 0;
+    }
+    if (mWatch >= 0 && info.st_ino == mDirectoryInode) {
+        return (false);
+    }
+
+    // The directory was removed or replaced, the old watch is useless
+    if (mWatch >= 0) {
+        inotify_rm_watch(mNotify, mWatch);
+    }
+    mWatch = inotify_add_watch(
+        mNotify, mDirectory.c_str(), ARC_LIBRARY_EVENTS
+    );
+    mDirectoryInode = info.st_ino;
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool LibraryRegistry::ReadEvents(void)
+{
+    alignas(inotify_event) char buffer[4096];
+    bool changed = false;
+    ssize_t length;
+
+    while ((length = read(mNotify, buffer, sizeof(buffer))) > 0) {
+        for (ssize_t offset = 0; offset < length;) {
+            const inotify_event* event =
+                reinterpret_cast<const inotify_event*>(buffer + offset);
+
+            if (event->wd == mWatch && (event->mask & IN_IGNORED)) {
+                mWatch = -1;
+            }
+            changed = true;
+            offset += sizeof(inotify_event) + event->len;
+        }
+    }
+    if (length < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+        changed = true;
+    }
+    return (changed);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool LibraryRegistry::Refresh(void)
+{
+    if (mNotify >= 0 && ReadEvents()) {
+        mStale = true;
+    }
+    if (Watch()) {
+        mStale = true;
+    }
+    if (!mStale) {
+        return (false);
+    }
+    mStale = false;
+
+    Names games = std::move(mGames);
+    Names graphics = std::move(mGraphics);
+
+    mGames.clear();
+    mGraphics.clear();
+    Scan();
+    return (games != mGames || graphics != mGraphics);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void LibraryRegistry::Scan(void)
+{
+    std::unordered_map<std::string, Entry> entries;
+    std::error_code error;
+
+    for (const auto& file : fs::directory_iterator(mDirectory, error)) {
+        std::string path = file.path().string();
+        struct stat info;
+
+        if (
+            file.path().extension() != ".so" ||
+            stat(path.c_str(), &info) != 0 || !S_ISREG(info.st_mode)
+        ) {
+            continue;
+        }
+
+        auto cached = mEntries.find(path);
+        Entry entry;
+
+        if (
+            cached != mEntries.end() &&
+            cached->second.inode == info.st_ino &&
+            cached->second.mtime.tv_sec == info.st_mtim.tv_sec &&
+            cached->second.mtime.tv_nsec == info.st_mtim.tv_nsec &&
+            cached->second.size == info.st_size
+        ) {
+            entry = std::move(cached->second);
+        } else {
+            entry = {info.st_ino, info.st_mtim, info.st_size, MODULE_NONE, ""};
+            if (auto descriptor = ReadModuleDescriptor(path)) {
+                if ((descriptor->flags & ARC_MODULE_HIDDEN) == 0) {
+                    entry.kind = static_cast<ModuleKind>(descriptor->kind);
+                    entry.name = descriptor->name;
+                }
+            } else if (auto name = Library::Is<IGraphicsModule>(path)) {
+                entry.kind = MODULE_GRAPHICS;
+                entry.name = name.value();
+            } else if (auto name = Library::Is<IGameModule>(path)) {
+                entry.kind = MODULE_GAME;
+                entry.name = name.value();
+            }
+        }
+
+        if (entry.kind == MODULE_GRAPHICS) {
+            mGraphics[path] = entry.name;
+        } else if (entry.kind == MODULE_GAME) {
+            mGames[path] = entry.name;
+        }
+        entries.emplace(path, std::move(entry));
+    }
+    if (error) {
+        std::cerr << "Error accessing directory: "
+                  << error.message() << std::endl;
+    }
+    mEntries = std::move(entries);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const LibraryRegistry::Names& LibraryRegistry::GetGames(void) const
+{
+    return (mGames);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const LibraryRegistry::Names& LibraryRegistry::GetGraphics(void) const
+{
+    return (mGraphics);
+}
+
+} // namespace Arc
@@ -0,0 +1,149 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Arcade/core/ModuleDescriptor.hpp"
+#include <ctime>
+#include <map>
+#include <string>
+#include <sys/types.h>
+#include <unordered_map>
+
+///////////////////////////////////////////////////////////////////////////////
+//
+///////////////////////////////////////////////////////////////////////////////
+#define ARC_LIBRARY_DIRECTORY       "lib"
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief The game and graphics libraries found in the library directory
+///
+/// Each file is probed once and the result is cached by inode,
+/// modification time and size. Probing reads the module descriptor, the
+/// libraries without one are opened instead, which runs their static
+/// initializers. The directory is watched with
+/// inotify: Refresh only stats the directory until a file is added,
+/// replaced or removed. Without inotify the directory is listed on every
+/// refresh, which costs a stat per file.
+///
+///////////////////////////////////////////////////////////////////////////////
+class LibraryRegistry
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Library path to the name reported by the library
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    using Names = std::map<std::string, std::string>;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Result of probing one file
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Entry
+    {
+        ino_t inode;                        //<! File identity
+        std::timespec mtime;                //<! Last modification
+        off_t size;                         //<! File size
+        ModuleKind kind;                    //<! Module type
+        std::string name;                   //<! Reported name
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Member data
+    ///////////////////////////////////////////////////////////////////////////
+    std::string mDirectory;                 //<! Watched directory
+    int mNotify;                            //<! inotify descriptor or -1
+    int mWatch;                             //<! Directory watch or -1
+    ino_t mDirectoryInode;                  //<! Directory being watched
+    bool mStale;                            //<! The directory must be read
+    std::unordered_map<
+        std::string, Entry
+    > mEntries;                             //<! Probe cache by path
+    Names mGames;                           //<! Game libraries
+    Names mGraphics;                        //<! Graphics libraries
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor, starts watching the directory
+    ///
+    /// \param directory The library directory
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit LibraryRegistry(
+        const std::string& directory = ARC_LIBRARY_DIRECTORY
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ~LibraryRegistry();
+
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    LibraryRegistry(const LibraryRegistry&) = delete;
+    LibraryRegistry& operator=(const LibraryRegistry&) = delete;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Update the lists if the directory changed
+    ///
+    /// \return True if the game or graphics list differs from before
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool Refresh(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return The game libraries
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const Names& GetGames(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return The graphics libraries
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const Names& GetGraphics(void) const;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Watch the directory, again if it was replaced
+    ///
+    /// \return True if the watch was added now, changes may have been missed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool Watch(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Consume the pending inotify events
+    ///
+    /// \return True if one of them may change the lists
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool ReadEvents(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief List the directory, probing the new and changed files
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Scan(void);
+};
+
+} // namespace Arc
@@ -0,0 +1,161 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Arcade/core/ModuleDescriptor.hpp"
+#include <cstring>
+#include <elf.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Find the descriptor section of a mapped ELF file
+///
+/// \tparam Ehdr The ELF header type of the file class
+/// \tparam Shdr The section header type of the file class
+///
+/// \param data The mapped file
+/// \param size The file size
+///
+/// \return The section header, or nullptr if there is none
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename Ehdr, typename Shdr>
+static const Shdr* FindSection(const char* data, size_t size)
+{
+    if (size < sizeof(Ehdr)) {
+        return (nullptr);
+    }
+
+    const Ehdr* header = reinterpret_cast<const Ehdr*>(data);
+
+    if (
+        header->e_shentsize != sizeof(Shdr) ||
+        header->e_shoff == 0 ||
+        header->e_shstrndx >= header->e_shnum ||
+        header->e_shoff > size ||
+        header->e_shnum > (size - header->e_shoff) / sizeof(Shdr)
+    ) {
+        return (nullptr);
+    }
+
+    const Shdr* sections = reinterpret_cast<const Shdr*>(
+        data + header->e_shoff
+    );
+    const Shdr& names = sections[header->e_shstrndx];
+
+    if (names.sh_offset > size || names.sh_size > size - names.sh_offset) {
+        return (nullptr);
+    }
+
+    size_t length = std::strlen(ARC_MODULE_SECTION);
+
+    for (size_t i = 0; i < header->e_shnum; i++) {
+        if (
+            sections[i].sh_name < names.sh_size &&
+            names.sh_size - sections[i].sh_name > length &&
+            std::memcmp(
+                data + names.sh_offset + sections[i].sh_name,
+                ARC_MODULE_SECTION, length + 1
+            ) == 0
+        ) {
+            return (&sections[i]);
+        }
+    }
+    return (nullptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Read the descriptor of a mapped ELF file
+///
+/// \tparam Ehdr The ELF header type of the file class
+/// \tparam Shdr The section header type of the file class
+///
+/// \param data The mapped file
+/// \param size The file size
+///
+/// \return The descriptor, or nothing if there is no valid one
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename Ehdr, typename Shdr>
+static std::optional<ModuleDescriptor> ReadSection(
+    const char* data,
+    size_t size
+)
+{
+    const Shdr* section = FindSection<Ehdr, Shdr>(data, size);
+    ModuleDescriptor descriptor;
+
+    if (
+        section == nullptr ||
+        section->sh_type == SHT_NOBITS ||
+        section->sh_offset > size ||
+        section->sh_size < sizeof(descriptor) ||
+        sizeof(descriptor) > size - section->sh_offset
+    ) {
+        return (std::nullopt);
+    }
+
+    std::memcpy(&descriptor, data + section->sh_offset, sizeof(descriptor));
+    if (
+        descriptor.magic != ARC_MODULE_MAGIC ||
+        descriptor.abiVersion != ARC_MODULE_ABI_VERSION ||
+        descriptor.kind == MODULE_NONE ||
+        descriptor.kind > MODULE_GRAPHICS
+    ) {
+        return (std::nullopt);
+    }
+    descriptor.name[ARC_MODULE_NAME_SIZE - 1] = '\0';
+    descriptor.spriteSheet[ARC_MODULE_PATH_SIZE - 1] = '\0';
+    return (descriptor);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::optional<ModuleDescriptor> ReadModuleDescriptor(const std::string& path)
+{
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    struct stat info;
+
+    if (fd < 0) {
+        return (std::nullopt);
+    }
+    if (fstat(fd, &info) != 0 || info.st_size < EI_NIDENT) {
+        close(fd);
+        return (std::nullopt);
+    }
+
+    size_t size = static_cast<size_t>(info.st_size);
+    void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return (std::nullopt);
+    }
+
+    const char* data = static_cast<const char*>(mapping);
+    std::optional<ModuleDescriptor> descriptor;
+
+    // Only files of the running byte order can hold a usable descriptor
+    if (
+        std::memcmp(data, ELFMAG, SELFMAG) == 0 &&
+        data[EI_DATA] == (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ ?
+            ELFDATA2LSB : ELFDATA2MSB)
+    ) {
+        if (data[EI_CLASS] == ELFCLASS64) {
+            descriptor = ReadSection<Elf64_Ehdr, Elf64_Shdr>(data, size);
+        } else if (data[EI_CLASS] == ELFCLASS32) {
+            descriptor = ReadSection<Elf32_Ehdr, Elf32_Shdr>(data, size);
+        }
+    }
+    munmap(mapping, size);
+    return (descriptor);
+}
+
+} // namespace Arc
@@ -0,0 +1,95 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdint>
+#include <optional>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+//
+///////////////////////////////////////////////////////////////////////////////
+#define ARC_MODULE_SECTION          ".arcade_module"
+#define ARC_MODULE_MAGIC            0x44435241u
+#define ARC_MODULE_ABI_VERSION      1
+#define ARC_MODULE_NAME_SIZE        64
+#define ARC_MODULE_PATH_SIZE        128
+
+///////////////////////////////////////////////////////////////////////////////
+// Capability flags
+///////////////////////////////////////////////////////////////////////////////
+#define ARC_MODULE_HIDDEN           (1u << 0)
+#define ARC_MODULE_TERMINAL         (1u << 1)
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Embed the descriptor of a module in its shared library
+///
+/// To be used once, in the Loader.cpp of the module, next to
+/// CreateArcadeObject.
+///
+/// \param kind The Arc::ModuleKind of the module
+/// \param name The name shown in the menu, as a string literal
+/// \param spriteSheet The path returned by GetSpriteSheet, decoded by the
+/// core before the game is loaded, empty for graphics modules
+/// \param flags The ARC_MODULE_ capability flags
+///
+///////////////////////////////////////////////////////////////////////////////
+#define ARC_MODULE_DESCRIPTOR(kind, name, spriteSheet, flags)               \
+    extern "C" __attribute__((used, section(ARC_MODULE_SECTION)))           \
+    const Arc::ModuleDescriptor ArcadeModuleDescriptor = {                  \
+        ARC_MODULE_MAGIC, ARC_MODULE_ABI_VERSION, kind, 0, flags,           \
+        name, spriteSheet                                                   \
+    }
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+///////////////////////////////////////////////////////////////////////////////
+enum ModuleKind : std::uint8_t
+{
+    MODULE_NONE,
+    MODULE_GAME,
+    MODULE_GRAPHICS
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief What a module is, readable without loading it
+///
+/// The descriptor lives in its own ELF section, so the core finds it by
+/// mapping the file and walking the section headers: no dlopen, no static
+/// initializer, no dependency loaded.
+///
+///////////////////////////////////////////////////////////////////////////////
+struct ModuleDescriptor
+{
+    std::uint32_t magic;                    //<! ARC_MODULE_MAGIC
+    std::uint16_t abiVersion;               //<! ARC_MODULE_ABI_VERSION
+    std::uint8_t kind;                      //<! ModuleKind
+    std::uint8_t reserved;                  //<! Zero
+    std::uint32_t flags;                    //<! ARC_MODULE_ flags
+    char name[ARC_MODULE_NAME_SIZE];        //<! Null terminated
+    char spriteSheet[ARC_MODULE_PATH_SIZE]; //<! Null terminated
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Read the descriptor embedded in a shared library
+///
+/// \param path The library path
+///
+/// \return The descriptor, or nothing if the file is not an ELF file or
+/// has no valid descriptor of this ABI version
+///
+///////////////////////////////////////////////////////////////////////////////
+std::optional<ModuleDescriptor> ReadModuleDescriptor(const std::string& path);
+
+} // namespace Arc
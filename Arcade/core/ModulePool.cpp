@@ -0,0 +1,232 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Arcade/core/ModulePool.hpp"
+#include "Arcade/errors/DLError.hpp"
+#include <dlfcn.h>
+#include <iostream>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+ModulePool::ModulePool(void)
+    : mClock(0)
+    , mStopping(false)
+    , mLoader(&ModulePool::LoadBehind, this)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+ModulePool::~ModulePool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopping = true;
+        mQueue.clear();
+    }
+    mWake.notify_one();
+    mLoader.join();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ModulePool& ModulePool::GetInstance(void)
+{
+    static ModulePool instance;
+    return (instance);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void* ModulePool::Acquire(const std::string& path)
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    auto it = mModules.find(path);
+
+    // A rebuilt library is only reopened once nothing uses the old code,
+    // dlopen would return the old handle for the same path otherwise
+    if (
+        it != mModules.end() && it->second.references == 0 &&
+        HasChanged(path, it->second)
+    ) {
+        void* stale = it->second.handle;
+
+        mModules.erase(it);
+        lock.unlock();
+        dlclose(stale);
+        lock.lock();
+        it = mModules.find(path);
+    }
+
+    if (it == mModules.end()) {
+        // dlopen may run static initializers for a long time, the loader
+        // thread must not wait for it
+        lock.unlock();
+
+        Module module = Open(path);
+
+        if (!module.handle) {
+            throw DLError(dlerror());
+        }
+        lock.lock();
+        it = mModules.find(path);
+        if (it == mModules.end()) {
+            it = mModules.emplace(path, module).first;
+        } else {
+            dlclose(module.handle);
+        }
+    }
+    it->second.references++;
+    it->second.lastUse = ++mClock;
+    return (it->second.handle);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ModulePool::Release(void* handle)
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    for (auto& [path, module] : mModules) {
+        if (module.handle == handle && module.references > 0) {
+            module.references--;
+            module.lastUse = ++mClock;
+            break;
+        }
+    }
+    Trim(lock);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ModulePool::Preload(const std::string& path)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        auto it = mModules.find(path);
+
+        // A rebuilt library waits for Acquire to replace the old handle
+        if (it != mModules.end()) {
+            if (!HasChanged(path, it->second)) {
+                it->second.lastUse = ++mClock;
+            }
+            return;
+        }
+        for (const std::string& queued : mQueue) {
+            if (queued == path) {
+                return;
+            }
+        }
+        mQueue.push_back(path);
+    }
+    mWake.notify_one();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ModulePool::Trim(std::unique_lock<std::mutex>& lock)
+{
+    std::vector<void*> closed;
+
+    while (true) {
+        size_t idle = 0;
+        auto oldest = mModules.end();
+
+        for (auto it = mModules.begin(); it != mModules.end(); ++it) {
+            if (it->second.references > 0) {
+                continue;
+            }
+            idle++;
+            if (
+                oldest == mModules.end() ||
+                it->second.lastUse < oldest->second.lastUse
+            ) {
+                oldest = it;
+            }
+        }
+        if (idle <= ARC_MODULE_POOL_IDLE) {
+            break;
+        }
+        closed.push_back(oldest->second.handle);
+        mModules.erase(oldest);
+    }
+
+    if (closed.empty()) {
+        return;
+    }
+    lock.unlock();
+    for (void* handle : closed) {
+        dlclose(handle);
+    }
+    lock.lock();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ModulePool::Module ModulePool::Open(const std::string& path)
+{
+    Module module{nullptr, 0, 0, 0, 0, {0, 0}};
+    struct stat info;
+
+    // Identified first: a file replaced meanwhile is seen as changed later
+    if (stat(path.c_str(), &info) == 0) {
+        module.device = info.st_dev;
+        module.inode = info.st_ino;
+        module.mtime = info.st_mtim;
+    }
+    module.handle = dlopen(path.c_str(), RTLD_LAZY);
+    return (module);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool ModulePool::HasChanged(const std::string& path, const Module& module)
+{
+    struct stat info;
+
+    if (stat(path.c_str(), &info) != 0) {
+        return (false);
+    }
+    return (
+        info.st_dev != module.device ||
+        info.st_ino != module.inode ||
+        info.st_mtim.tv_sec != module.mtime.tv_sec ||
+        info.st_mtim.tv_nsec != module.mtime.tv_nsec
+    );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ModulePool::LoadBehind(void)
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    while (true) {
+        mWake.wait(lock, [this] { return (mStopping || !mQueue.empty()); });
+        if (mStopping) {
+            return;
+        }
+
+        std::string path = mQueue.front();
+
+        mQueue.pop_front();
+        if (mModules.count(path) > 0) {
+            continue;
+        }
+
+        lock.unlock();
+        Module module = Open(path);
+        lock.lock();
+
+        if (!module.handle) {
+            std::cerr << "Failed to preload " << path << std::endl;
+            continue;
+        }
+        if (mModules.count(path) > 0) {
+            dlclose(module.handle);
+            continue;
+        }
+        module.lastUse = ++mClock;
+        mModules.emplace(path, module);
+        Trim(lock);
+    }
+}
+
+} // namespace Arc
@@ -0,0 +1,173 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include <condition_variable>
+#include <cstdint>
+#include <ctime>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <sys/stat.h>
+#include <thread>
+#include <unordered_map>
+
+///////////////////////////////////////////////////////////////////////////////
+//
+///////////////////////////////////////////////////////////////////////////////
+#define ARC_MODULE_POOL_IDLE        6
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Shared library handles kept resident between module switches
+///
+/// Every object created from a library holds a reference on its handle.
+/// When the last one is destroyed the handle stays open, so switching back
+/// to the library does not dlopen it again. Only the most recently used
+/// idle handles are kept, ARC_MODULE_POOL_IDLE of them.
+///
+/// Libraries can also be preloaded by a background thread, so that the
+/// next switch only constructs the object.
+///
+/// Each handle remembers the device, inode and modification time of its
+/// file. A library rebuilt at the same path is opened again once its old
+/// handle is idle, and is not preloaded until then.
+///
+///////////////////////////////////////////////////////////////////////////////
+class ModulePool
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Module
+    {
+        void* handle;                       //<! dlopen handle
+        int references;                     //<! Live objects
+        std::uint64_t lastUse;              //<! Pool clock at last use
+        dev_t device;                       //<! File identity when opened
+        ino_t inode;                        //<! File identity when opened
+        std::timespec mtime;                //<! Last modification
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Member data
+    ///////////////////////////////////////////////////////////////////////////
+    std::unordered_map<
+        std::string, Module
+    > mModules;                             //<! Open libraries by path
+    std::deque<std::string> mQueue;         //<! Paths to preload
+    std::uint64_t mClock;                   //<! Use counter for the LRU
+    std::mutex mMutex;                      //<! Guards the members above
+    std::condition_variable mWake;          //<! Signals a queued path
+    bool mStopping;                         //<! The loader must exit
+    std::thread mLoader;                    //<! Preloading thread
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ModulePool(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Stop the loader, the handles stay open until the exit
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ~ModulePool();
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    ModulePool(const ModulePool&) = delete;
+    ModulePool& operator=(const ModulePool&) = delete;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return The pool
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static ModulePool& GetInstance(void);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get a handle on a library, opening it if it is not resident
+    ///
+    /// \param path The library path
+    ///
+    /// \return The handle, to give back with Release
+    ///
+    /// \throw DLError if the library cannot be opened
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void* Acquire(const std::string& path);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Give back a handle, it stays resident while the pool has room
+    ///
+    /// \param handle The handle returned by Acquire
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Release(void* handle);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Open a library in background if it is not resident
+    ///
+    /// \param path The library path
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Preload(const std::string& path);
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Close the least recently used idle handles over the limit
+    ///
+    /// \param lock The held pool lock, released around dlclose
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Trim(std::unique_lock<std::mutex>& lock);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Open a library and remember the identity of its file
+    ///
+    /// \param path The library path
+    ///
+    /// \return The module, with a null handle if dlopen failed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static Module Open(const std::string& path);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Check if the file of a module was replaced since it was opened
+    ///
+    /// \param path The library path
+    /// \param module The resident module
+    ///
+    /// \return True if the file is another one or was modified, false if it
+    /// is the same or cannot be read
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static bool HasChanged(const std::string& path, const Module& module);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Body of the loader thread
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void LoadBehind(void);
+};
+
+} // namespace Arc
@@ -0,0 +1,273 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Arcade/core/Profiler.hpp"
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<bool> Profiler::mEnabled(false);
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<bool> Profiler::mDumpRequested(false);
+
+///////////////////////////////////////////////////////////////////////////////
+std::string Profiler::mPath;
+
+///////////////////////////////////////////////////////////////////////////////
+std::mutex Profiler::mMutex;
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::unique_ptr<Profiler::Ring>> Profiler::mRings;
+
+///////////////////////////////////////////////////////////////////////////////
+thread_local Profiler::RingOwner Profiler::mOwner{nullptr};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief A zone copied out of a ring
+///
+///////////////////////////////////////////////////////////////////////////////
+struct Copy
+{
+    const char* name;                       //<! String literal
+    std::uint64_t start;                    //<! Nanoseconds
+    std::uint64_t end;                      //<! Nanoseconds
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Write a string as a JSON string
+///
+/// \param file The output
+/// \param string The string
+///
+///////////////////////////////////////////////////////////////////////////////
+static void WriteString(std::ofstream& file, const std::string& string)
+{
+    file << '"';
+    for (char c : string) {
+        if (c == '"' || c == '\\') {
+            file << '\\';
+        }
+        file << (static_cast<unsigned char>(c) < 0x20 ? ' ' : c);
+    }
+    file << '"';
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Profiler::Zone::Zone(const char* name)
+    : mName(mEnabled.load(std::memory_order_relaxed) ? name : nullptr)
+    , mStart(mName ? Now() : 0)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+Profiler::Zone::~Zone()
+{
+    if (mName) {
+        Record(mName, mStart, Now());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Profiler::RingOwner::~RingOwner()
+{
+    if (ring) {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        ring->used = false;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Profiler::Initialize(const std::string& path)
+{
+    struct sigaction action = {};
+
+    mPath = path;
+    action.sa_handler = [](int) { RequestDump(); };
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART;
+    sigaction(SIGUSR1, &action, nullptr);
+    Now();
+    mEnabled = true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Profiler::Shutdown(void)
+{
+    if (!mEnabled) {
+        return;
+    }
+    mEnabled = false;
+    Dump(mPath);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Profiler::IsEnabled(void)
+{
+    return (mEnabled.load(std::memory_order_relaxed));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Profiler::SetThreadName(const std::string& name)
+{
+    if (!IsEnabled()) {
+        return;
+    }
+
+    Ring& ring = GetRing();
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    ring.name = name;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Profiler::RequestDump(void)
+{
+    mDumpRequested.store(true, std::memory_order_relaxed);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Profiler::Update(void)
+{
+    if (mDumpRequested.exchange(false, std::memory_order_relaxed)) {
+        Dump(mPath);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Profiler::Dump(const std::string& path)
+{
+    std::ofstream file(path, std::ios::trunc);
+    std::size_t zones = 0;
+
+    if (!file) {
+        std::cerr << "Failed to write trace " << path << std::endl;
+        return (false);
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    bool first = true;
+
+    file << std::fixed << std::setprecision(3)
+         << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    for (const std::unique_ptr<Ring>& ring : mRings) {
+        std::uint64_t head = ring->head.load(std::memory_order_acquire);
+        std::uint64_t begin = head > ARC_PROFILER_CAPACITY
+            ? head - ARC_PROFILER_CAPACITY : 0;
+        std::vector<Copy> copies;
+
+        copies.reserve(head - begin);
+        for (std::uint64_t i = begin; i < head; i++) {
+            const Event& event = ring->events[i % ARC_PROFILER_CAPACITY];
+
+            copies.push_back({
+                event.name.load(std::memory_order_relaxed),
+                event.start.load(std::memory_order_relaxed),
+                event.end.load(std::memory_order_relaxed)
+            });
+        }
+
+        // The zones the thread overwrote during the copy are dropped, the
+        // slot of the zone it is writing included
+        std::uint64_t after = ring->head.load(std::memory_order_acquire);
+        std::uint64_t valid = after >= ARC_PROFILER_CAPACITY
+            ? std::max(begin, after - ARC_PROFILER_CAPACITY + 1) : begin;
+
+        file << (first ? "" : ",")
+             << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+             << ring->id << ",\"args\":{\"name\":";
+        WriteString(file, ring->name);
+        file << "}}";
+        first = false;
+        for (std::uint64_t i = valid; i < head; i++) {
+            const Copy& copy = copies[i - begin];
+
+            file << ",\n{\"name\":";
+            WriteString(file, copy.name);
+            file << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << ring->id
+                 << ",\"ts\":" << copy.start / 1000.0
+                 << ",\"dur\":" << (copy.end - copy.start) / 1000.0 << "}";
+            zones++;
+        }
+    }
+    file << "\n]}\n";
+    file.close();
+    if (!file) {
+        std::cerr << "Failed to write trace " << path << std::endl;
+        return (false);
+    }
+    std::cerr << "Profiler: " << zones << " zones written to "
+              << path << std::endl;
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t Profiler::Now(void)
+{
+    using Clock = std::chrono::steady_clock;
+    static const Clock::time_point epoch = Clock::now();
+
+    return (static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            Clock::now() - epoch
+        ).count()
+    ));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Profiler::Ring& Profiler::GetRing(void)
+{
+    if (mOwner.ring) {
+        return (*mOwner.ring);
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    for (const std::unique_ptr<Ring>& ring : mRings) {
+        if (!ring->used) {
+            ring->used = true;
+            mOwner.ring = ring.get();
+            return (*ring);
+        }
+    }
+
+    std::unique_ptr<Ring> ring = std::make_unique<Ring>();
+
+    ring->events = std::make_unique<Event[]>(ARC_PROFILER_CAPACITY);
+    ring->head = 0;
+    ring->id = static_cast<int>(mRings.size()) + 1;
+    ring->name = "Thread " + std::to_string(ring->id);
+    ring->used = true;
+    mOwner.ring = ring.get();
+    mRings.push_back(std::move(ring));
+    return (*mOwner.ring);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Profiler::Record(
+    const char* name,
+    std::uint64_t start,
+    std::uint64_t end
+)
+{
+    Ring& ring = GetRing();
+    std::uint64_t head = ring.head.load(std::memory_order_relaxed);
+    Event& event = ring.events[head % ARC_PROFILER_CAPACITY];
+
+    event.name.store(name, std::memory_order_relaxed);
+    event.start.store(start, std::memory_order_relaxed);
+    event.end.store(end, std::memory_order_relaxed);
+    ring.head.store(head + 1, std::memory_order_release);
+}
+
+} // namespace Arc
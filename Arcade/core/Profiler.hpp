@@ -0,0 +1,233 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Define the profiler visibility
+///////////////////////////////////////////////////////////////////////////////
+#ifndef PROFILER_EXPORT
+    #define PROFILER_EXPORT __attribute__((visibility("default")))
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+//
+///////////////////////////////////////////////////////////////////////////////
+#define ARC_PROFILER_CAPACITY       65536
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Time the rest of the enclosing scope as a profiler zone
+///
+/// \param name A string literal, it is read when the trace is written
+///
+///////////////////////////////////////////////////////////////////////////////
+#define ARC_PROFILE_ZONE(name)                                              \
+    Arc::Profiler::Zone ARC_PROFILE_CONCAT(arcProfileZone, __LINE__)(name)
+
+///////////////////////////////////////////////////////////////////////////////
+//
+///////////////////////////////////////////////////////////////////////////////
+#define ARC_PROFILE_CONCAT(a, b)    ARC_PROFILE_CONCAT_(a, b)
+#define ARC_PROFILE_CONCAT_(a, b)   a##b
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Scoped timers, written as a Chrome trace_event file on demand
+///
+/// Each thread records its zones in its own ring buffer of the last
+/// ARC_PROFILER_CAPACITY zones, without locks: the writer publishes a zone
+/// by moving the head of its ring, and the dump drops the zones that were
+/// overwritten while it copied them. The rings of the threads that ended
+/// are reused by the next ones.
+///
+/// Disabled, a zone costs one relaxed atomic load. The core, the games and
+/// the graphics modules share the same profiler, see ARC_PROFILE_ZONE.
+///
+///////////////////////////////////////////////////////////////////////////////
+class PROFILER_EXPORT Profiler
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Scoped zone, recorded when it is destroyed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    class Zone
+    {
+    private:
+        ///////////////////////////////////////////////////////////////////////
+        // Member data
+        ///////////////////////////////////////////////////////////////////////
+        const char* mName;                  //<! Nullptr when disabled
+        std::uint64_t mStart;               //<! Nanoseconds
+
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Start the zone
+        ///
+        /// \param name A string literal
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        explicit Zone(const char* name);
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Record the zone
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        ~Zone();
+
+        ///////////////////////////////////////////////////////////////////////
+        //
+        ///////////////////////////////////////////////////////////////////////
+        Zone(const Zone&) = delete;
+        Zone& operator=(const Zone&) = delete;
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A recorded zone, its fields are atomic so a dump may read them
+    /// while they are overwritten
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Event
+    {
+        std::atomic<const char*> name;      //<! String literal
+        std::atomic<std::uint64_t> start;   //<! Nanoseconds
+        std::atomic<std::uint64_t> end;     //<! Nanoseconds
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The ring of one thread
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Ring
+    {
+        std::unique_ptr<Event[]> events;    //<! ARC_PROFILER_CAPACITY
+        std::atomic<std::uint64_t> head;    //<! Zones written
+        std::string name;                   //<! Thread name, under mMutex
+        int id;                             //<! Trace thread id
+        bool used;                          //<! By a thread, under mMutex
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Give the ring of a thread back when it ends
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct RingOwner
+    {
+        Ring* ring;                         //<! Nullptr until a zone ends
+
+        ~RingOwner();
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Member data
+    ///////////////////////////////////////////////////////////////////////////
+    static std::atomic<bool> mEnabled;
+    static std::atomic<bool> mDumpRequested;
+    static std::string mPath;
+    static std::mutex mMutex;
+    static std::vector<std::unique_ptr<Ring>> mRings;
+    static thread_local RingOwner mOwner;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Start recording, and dump when SIGUSR1 is received
+    ///
+    /// \param path The trace file
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void Initialize(const std::string& path);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Dump a last time and stop recording
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void Shutdown(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Check if the zones are recorded
+    ///
+    /// \return True between Initialize and Shutdown
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static bool IsEnabled(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Name the calling thread in the trace
+    ///
+    /// \param name The thread name
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void SetThreadName(const std::string& name);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Ask for a dump at the next Update, safe in a signal handler
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void RequestDump(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Write the trace if a dump was asked for, once per frame
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void Update(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Write the zones of every thread as Chrome trace_event JSON
+    ///
+    /// \param path The trace file
+    ///
+    /// \return False if the file cannot be written
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static bool Dump(const std::string& path);
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the time since the first call
+    ///
+    /// \return Nanoseconds
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static std::uint64_t Now(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the ring of the calling thread, taking one if needed
+    ///
+    /// \return The ring
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static Ring& GetRing(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Record a zone in the ring of the calling thread
+    ///
+    /// \param name The zone name
+    /// \param start Its start, in nanoseconds
+    /// \param end Its end, in nanoseconds
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void Record(
+        const char* name,
+        std::uint64_t start,
+        std::uint64_t end
+    );
+};
+
+} // namespace Arc
@@ -0,0 +1,218 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Arcade/core/ScoreStore.hpp"
+#include "Arcade/utils/BinaryIO.hpp"
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward namespace std::filesystem
+///////////////////////////////////////////////////////////////////////////////
+namespace fs = std::filesystem;
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Parse a binary save
+///
+/// \param path The file path
+/// \param scores The scores to fill
+///
+/// \return False if the file is missing or not a score file
+///
+///////////////////////////////////////////////////////////////////////////////
+static bool ReadBinary(const fs::path& path, std::map<std::string, int>& scores)
+{
+    std::ifstream file(path, std::ios::binary);
+    char magic[4];
+    std::uint8_t version = 0;
+    std::uint32_t count = 0;
+
+    if (!file.is_open()) {
+        return (false);
+    }
+    file.read(magic, sizeof(magic));
+    if (
+        file.gcount() != sizeof(magic) ||
+        std::memcmp(magic, ARC_SCORE_MAGIC, sizeof(magic)) != 0 ||
+        !ReadValue(file, version) || version != ARC_SCORE_VERSION ||
+        !ReadValue(file, count)
+    ) {
+        std::cerr << "Invalid score file: " << path << std::endl;
+        return (false);
+    }
+
+    for (std::uint32_t i = 0; i < count; i++) {
+        std::uint16_t length = 0;
+        std::int32_t score = 0;
+        std::string game;
+
+        if (!ReadValue(file, length)) {
+            break;
+        }
+        game.resize(length);
+        file.read(game.data(), length);
+        if (file.gcount() != length || !ReadValue(file, score)) {
+            break;
+        }
+        scores[game] = score;
+    }
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Parse a text save of the previous format
+///
+/// \param path The file path
+/// \param scores The scores to fill
+///
+///////////////////////////////////////////////////////////////////////////////
+static void ReadText(const fs::path& path, std::map<std::string, int>& scores)
+{
+    std::ifstream file(path);
+    std::string line;
+
+    while (std::getline(file, line)) {
+        size_t sep = line.find(':');
+
+        if (sep == std::string::npos) {
+            continue;
+        }
+        try {
+            scores[line.substr(0, sep)] = std::stoi(line.substr(sep + 1));
+        } catch (const std::exception&) {
+            continue;
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ScoreStore::ScoreStore(const std::string& directory)
+    : mDirectory(directory)
+    , mStopping(false)
+    , mWriter(&ScoreStore::WriteBehind, this)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+ScoreStore::~ScoreStore()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopping = true;
+    }
+    mWake.notify_one();
+    mWriter.join();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int ScoreStore::GetBest(const std::string& user, const std::string& game)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    const Scores& scores = Load(user);
+    auto it = scores.find(game);
+
+    return (it == scores.end() ? 0 : it->second);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool ScoreStore::Submit(
+    const std::string& user,
+    const std::string& game,
+    int score
+)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        Scores& scores = Load(user);
+        auto [it, inserted] = scores.try_emplace(game, score);
+
+        if (!inserted && score <= it->second) {
+            return (false);
+        }
+        it->second = score;
+        mDirty.insert(user);
+    }
+    mWake.notify_one();
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ScoreStore::Scores& ScoreStore::Load(const std::string& user)
+{
+    auto [it, inserted] = mUsers.try_emplace(user);
+
+    if (inserted) {
+        fs::path base = fs::path(mDirectory) / user;
+
+        if (!ReadBinary(base.string() + ".scores", it->second)) {
+            ReadText(base.string() + ".save", it->second);
+        }
+    }
+    return (it->second);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ScoreStore::Write(const std::string& user, const Scores& scores) const
+{
+    fs::path base = fs::path(mDirectory) / user;
+    fs::path path = base.string() + ".scores";
+    fs::path temporary = base.string() + ".scores.tmp";
+    std::vector<char> buffer(ARC_SCORE_MAGIC, ARC_SCORE_MAGIC + 4);
+
+    WriteValue<std::uint8_t>(buffer, ARC_SCORE_VERSION);
+    WriteValue<std::uint32_t>(buffer, scores.size());
+    for (const auto& [game, score] : scores) {
+        WriteValue<std::uint16_t>(buffer, game.size());
+        buffer.insert(buffer.end(), game.begin(), game.end());
+        WriteValue<std::int32_t>(buffer, score);
+    }
+
+    try {
+        fs::create_directories(mDirectory);
+
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+
+        file.write(buffer.data(), buffer.size());
+        file.close();
+        if (!file) {
+            std::cerr << "Failed to write score file: "
+                      << temporary << std::endl;
+            return;
+        }
+        fs::rename(temporary, path);
+    } catch (const fs::filesystem_error& e) {
+        std::cerr << "Failed to save scores: " << e.what() << std::endl;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ScoreStore::WriteBehind(void)
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    while (true) {
+        mWake.wait(lock, [this] { return (mStopping || !mDirty.empty()); });
+        if (mDirty.empty()) {
+            return;
+        }
+
+        std::string user = *mDirty.begin();
+        Scores scores = mUsers[user];
+
+        mDirty.erase(mDirty.begin());
+        lock.unlock();
+        Write(user, scores);
+        lock.lock();
+    }
+}
+
+} // namespace Arc
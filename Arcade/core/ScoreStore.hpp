@@ -0,0 +1,139 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+///////////////////////////////////////////////////////////////////////////////
+//
+///////////////////////////////////////////////////////////////////////////////
+#define ARC_SCORE_DIRECTORY         ".saves"
+#define ARC_SCORE_MAGIC             "ARCS"
+#define ARC_SCORE_VERSION           1
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Best scores of every player, kept in memory
+///
+/// A player's file is read the first time one of their scores is asked for,
+/// then every lookup is served from memory. New records are written behind
+/// by a background thread, to a temporary file renamed over the previous
+/// one, so a crash never leaves a truncated save.
+///
+/// The files are <directory>/<user>.scores:
+/// "ARCS", u8 version, u32 count, then count times u16 name length, the
+/// name bytes and an i32 score, all in host byte order. The older text
+/// saves, <user>.save with "game:score" lines, are imported when no binary
+/// file exists yet.
+///
+///////////////////////////////////////////////////////////////////////////////
+class ScoreStore
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    using Scores = std::map<std::string, int>;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Member data
+    ///////////////////////////////////////////////////////////////////////////
+    std::string mDirectory;                 //<! Where the saves live
+    std::unordered_map<
+        std::string, Scores
+    > mUsers;                               //<! Loaded players
+    std::set<std::string> mDirty;           //<! Players waiting for a write
+    std::mutex mMutex;                      //<! Guards the members above
+    std::condition_variable mWake;          //<! Signals a dirty player
+    bool mStopping;                         //<! The writer must exit
+    std::thread mWriter;                    //<! Write-behind thread
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor, starts the writer thread
+    ///
+    /// \param directory The save directory
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit ScoreStore(const std::string& directory = ARC_SCORE_DIRECTORY);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Destructor, writes the pending records and stops the thread
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ~ScoreStore();
+
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    ScoreStore(const ScoreStore&) = delete;
+    ScoreStore& operator=(const ScoreStore&) = delete;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the best score of a player on a game
+    ///
+    /// \param user The player name
+    /// \param game The game name
+    ///
+    /// \return The best score, 0 if the player never finished the game
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    int GetBest(const std::string& user, const std::string& game);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Record a finished game
+    ///
+    /// \param user The player name
+    /// \param game The game name
+    /// \param score The final score
+    ///
+    /// \return True if it is a new record, it is then saved in background
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool Submit(const std::string& user, const std::string& game, int score);
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the scores of a player, loading them the first time
+    ///
+    /// \param user The player name, the mutex must be held
+    ///
+    /// \return The cached scores
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Scores& Load(const std::string& user);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Write a player's scores and rename them over the old file
+    ///
+    /// \param user The player name
+    /// \param scores A copy of the scores, written without the mutex
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Write(const std::string& user, const Scores& scores) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Body of the writer thread
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void WriteBehind(void);
+};
+
+} // namespace Arc
@@ -0,0 +1,101 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Arcade/core/SpriteRegistry.hpp"
+#include "Arcade/errors/Exception.hpp"
+#include <limits>
+#include <string.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t SpriteRegistry::Hasher::operator()(const Sprite& sprite) const
+{
+    std::size_t hash = 14695981039346656037ULL;
+    auto mix = [&hash](std::size_t value) {
+        hash = (hash ^ value) * 1099511628211ULL;
+    };
+
+    mix(static_cast<std::size_t>(sprite.atlas.x));
+    mix(static_cast<std::size_t>(sprite.atlas.y));
+    mix(static_cast<std::size_t>(sprite.size.x));
+    mix(static_cast<std::size_t>(sprite.size.y));
+    mix(static_cast<std::size_t>(sprite.color.r));
+    mix(static_cast<std::size_t>(sprite.color.g));
+    mix(static_cast<std::size_t>(sprite.color.b));
+    for (const char* c = sprite.glyph; *c; c++) {
+        mix(static_cast<std::size_t>(*c));
+    }
+    return (hash);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool SpriteRegistry::Equal::operator()(
+    const Sprite& lhs,
+    const Sprite& rhs
+) const
+{
+    return (
+        lhs.atlas == rhs.atlas &&
+        lhs.size == rhs.size &&
+        lhs.color.r == rhs.color.r &&
+        lhs.color.g == rhs.color.g &&
+        lhs.color.b == rhs.color.b &&
+        strcmp(lhs.glyph, rhs.glyph) == 0
+    );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+SpriteRegistry::SpriteRegistry(void)
+{
+    mSprites.reserve(ARC_SPRITE_REGISTRY_SIZE);
+    mIndex.reserve(ARC_SPRITE_REGISTRY_SIZE);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+SpriteHandle SpriteRegistry::Register(const IGameModule::Asset& asset)
+{
+    Sprite sprite;
+    std::size_t length = std::min(
+        asset.characters.size(),
+        static_cast<std::size_t>(ARC_SPRITE_GLYPH_SIZE - 1)
+    );
+
+    sprite.atlas = asset.position;
+    sprite.size = asset.size;
+    sprite.color = asset.color;
+    memset(sprite.glyph, 0, ARC_SPRITE_GLYPH_SIZE);
+    memcpy(sprite.glyph, asset.characters.data(), length);
+
+    auto it = mIndex.find(sprite);
+    if (it != mIndex.end()) {
+        return (it->second);
+    }
+
+    if (mSprites.size() > std::numeric_limits<SpriteHandle>::max()) {
+        throw Exception("Sprite registry is full");
+    }
+
+    SpriteHandle handle = static_cast<SpriteHandle>(mSprites.size());
+    mSprites.push_back(sprite);
+    mIndex.emplace(sprite, handle);
+    return (handle);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const Sprite& SpriteRegistry::Get(SpriteHandle handle) const
+{
+    return (mSprites[handle]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Span<const Sprite> SpriteRegistry::GetSprites(void) const
+{
+    return (Span<const Sprite>(mSprites.data(), mSprites.size()));
+}
+
+} // namespace Arc
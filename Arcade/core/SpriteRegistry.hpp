@@ -0,0 +1,128 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Arcade/interfaces/IGameModule.hpp"
+#include "Arcade/utils/Color.hpp"
+#include "Arcade/utils/Span.hpp"
+#include "Arcade/utils/Vec2.hpp"
+#include <cstdint>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+//
+///////////////////////////////////////////////////////////////////////////////
+#define ARC_SPRITE_GLYPH_SIZE       16
+#define ARC_SPRITE_REGISTRY_SIZE    512
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Compact reference to a sprite stored in the sprite registry
+///
+///////////////////////////////////////////////////////////////////////////////
+using SpriteHandle = std::uint16_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Registered sprite, shared by every draw referencing it
+///
+///////////////////////////////////////////////////////////////////////////////
+struct Sprite
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Member data
+    ///////////////////////////////////////////////////////////////////////////
+    Vec2i atlas;                            //<! Cell in the sprite sheet
+    Vec2i size;                             //<! Size in pixels
+    Color color;                            //<! Text-mode glyph color
+    char glyph[ARC_SPRITE_GLYPH_SIZE];      //<! Text-mode glyph
+};
+
+///////////////////////////////////////////////////////////////////////////////
+//
+///////////////////////////////////////////////////////////////////////////////
+static_assert(
+    std::is_trivially_copyable_v<Sprite>,
+    "Sprite must stay trivially copyable"
+);
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Interning table turning assets into stable sprite handles
+///
+///////////////////////////////////////////////////////////////////////////////
+class SpriteRegistry
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Hasher
+    {
+        std::size_t operator()(const Sprite& sprite) const;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Equal
+    {
+        bool operator()(const Sprite& lhs, const Sprite& rhs) const;
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Member data
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<Sprite> mSprites;                                   //<!
+    std::unordered_map<Sprite, SpriteHandle, Hasher, Equal> mIndex; //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    SpriteRegistry(void);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Register an asset, reusing the handle of an identical one
+    ///
+    /// \param asset The asset to register
+    ///
+    /// \return The handle of the sprite
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    SpriteHandle Register(const IGameModule::Asset& asset);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param handle
+    ///
+    /// \return The sprite referenced by the handle
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const Sprite& Get(SpriteHandle handle) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return A view over every registered sprite, indexed by handle
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Span<const Sprite> GetSprites(void) const;
+};
+
+} // namespace Arc
@@ -0,0 +1,77 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Arcade/core/StringPool.hpp"
+#include "Arcade/errors/Exception.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+StringPool::StringPool(void)
+{
+    Intern(std::string());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+StringId StringPool::Intern(const std::string& string)
+{
+    auto [it, inserted] = mIds.try_emplace(
+        string, static_cast<StringId>(mStrings.size())
+    );
+
+    if (inserted) {
+        mStrings.push_back(string);
+    }
+    return (it->second);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+StringList StringPool::Intern(const std::vector<std::string>& strings)
+{
+    std::vector<StringId> ids;
+
+    ids.reserve(strings.size());
+    for (const std::string& string : strings) {
+        ids.push_back(Intern(string));
+    }
+
+    auto [it, inserted] = mLists.try_emplace(
+        ids, static_cast<std::uint32_t>(mItems.size())
+    );
+
+    if (inserted) {
+        mItems.insert(mItems.end(), ids.begin(), ids.end());
+    }
+    return (StringList{it->second, static_cast<std::uint32_t>(ids.size())});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const std::string& StringPool::Get(StringId id) const
+{
+    if (id >= mStrings.size()) {
+        throw Exception("Unknown string id");
+    }
+    return (mStrings[id]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::string> StringPool::Get(const StringList& list) const
+{
+    if (list.offset + list.count > mItems.size()) {
+        throw Exception("Unknown string list");
+    }
+
+    std::vector<std::string> strings;
+
+    strings.reserve(list.count);
+    for (std::uint32_t i = 0; i < list.count; i++) {
+        strings.push_back(mStrings[mItems[list.offset + i]]);
+    }
+    return (strings);
+}
+
+} // namespace Arc
@@ -0,0 +1,110 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Compact reference to a string stored in the string pool
+///
+///////////////////////////////////////////////////////////////////////////////
+using StringId = std::uint32_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Compact reference to a list of strings stored in the string pool
+///
+///////////////////////////////////////////////////////////////////////////////
+struct StringList
+{
+    std::uint32_t offset;                   //<! First id in the pool
+    std::uint32_t count;                    //<! Number of ids
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Interning table keeping the strings out of the events
+///
+/// Equal strings, and equal lists of strings, share one entry, so pushing
+/// the same names over and over does not grow the pool. The strings are
+/// never moved, so a reference from Get survives later interning.
+///
+///////////////////////////////////////////////////////////////////////////////
+class StringPool
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Member data
+    ///////////////////////////////////////////////////////////////////////////
+    std::deque<std::string> mStrings;       //<! Indexed by StringId, stable
+    std::unordered_map<
+        std::string, StringId
+    > mIds;                                 //<! String to its id
+    std::vector<StringId> mItems;           //<! Ids of every list
+    std::map<
+        std::vector<StringId>, std::uint32_t
+    > mLists;                               //<! List to its offset
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Default constructor, id 0 is the empty string
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    StringPool(void);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the id of a string, adding it if it is new
+    ///
+    /// \param string The string
+    ///
+    /// \return The id of the string
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    StringId Intern(const std::string& string);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the reference of a list, adding it if it is new
+    ///
+    /// \param strings The strings
+    ///
+    /// \return The reference of the list
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    StringList Intern(const std::vector<std::string>& strings);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get an interned string
+    ///
+    /// \param id The id returned by Intern
+    ///
+    /// \return The string, valid until the pool is destroyed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const std::string& Get(StringId id) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the strings of an interned list
+    ///
+    /// \param list The reference returned by Intern
+    ///
+    /// \return A copy of the strings
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<std::string> Get(const StringList& list) const;
+};
+
+} // namespace Arc
@@ -0,0 +1,112 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Arcade/core/TileLayer.hpp"
+#include "Arcade/errors/Exception.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+TileLayer::TileLayer(void)
+    : mOrigin(0, 0)
+    , mWidth(0)
+    , mHeight(0)
+    , mVersion(0)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint32_t TileLayer::Upload(
+    const std::vector<SpriteHandle>& tiles,
+    int width,
+    int height,
+    const Vec2i& origin
+)
+{
+    if (width < 0 || height < 0 ||
+        tiles.size() != static_cast<std::size_t>(width * height)
+    ) {
+        throw Exception("Tile layer size does not match its tiles");
+    }
+
+    mTiles = tiles;
+    mOrigin = origin;
+    mWidth = width;
+    mHeight = height;
+    return (++mVersion);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint32_t TileLayer::SetTile(const Vec2i& cell, SpriteHandle sprite)
+{
+    if (cell.x < 0 || cell.y < 0 || cell.x >= mWidth || cell.y >= mHeight) {
+        throw Exception("Tile layer cell out of range");
+    }
+
+    SpriteHandle& tile = mTiles[cell.y * mWidth + cell.x];
+
+    if (tile != sprite) {
+        tile = sprite;
+        mVersion++;
+    }
+    return (mVersion);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void TileLayer::Clear(void)
+{
+    if (IsEmpty()) {
+        return;
+    }
+    mTiles.clear();
+    mWidth = 0;
+    mHeight = 0;
+    mVersion++;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+SpriteHandle TileLayer::Get(int x, int y) const
+{
+    return (mTiles[y * mWidth + x]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Span<const SpriteHandle> TileLayer::GetTiles(void) const
+{
+    return (Span<const SpriteHandle>(mTiles.data(), mTiles.size()));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const Vec2i& TileLayer::GetOrigin(void) const
+{
+    return (mOrigin);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int TileLayer::GetWidth(void) const
+{
+    return (mWidth);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int TileLayer::GetHeight(void) const
+{
+    return (mHeight);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint32_t TileLayer::GetVersion(void) const
+{
+    return (mVersion);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool TileLayer::IsEmpty(void) const
+{
+    return (mTiles.empty());
+}
+
+} // namespace Arc
@@ -0,0 +1,143 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Arcade/core/SpriteRegistry.hpp"
+#include "Arcade/utils/Span.hpp"
+#include "Arcade/utils/Vec2.hpp"
+#include <cstdint>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Retained grid of sprites drawn underneath the draw commands
+///
+/// The grid is only copied when the game uploads it, and every change bumps
+/// the version so backends can keep a prerendered copy until it moves.
+///
+///////////////////////////////////////////////////////////////////////////////
+class TileLayer
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Member data
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<SpriteHandle> mTiles;       //<! Row-major sprite handles
+    Vec2i mOrigin;                          //<! Grid position of cell 0, 0
+    int mWidth;                             //<! Width in cells
+    int mHeight;                            //<! Height in cells
+    std::uint32_t mVersion;                 //<! Bumped on every change
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Default constructor, the layer starts empty at version 0
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    TileLayer(void);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Replace the whole grid
+    ///
+    /// \param tiles The row-major sprite handles, width * height of them
+    /// \param width The width in cells
+    /// \param height The height in cells
+    /// \param origin The grid position of the top left cell
+    ///
+    /// \return The new version of the layer
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::uint32_t Upload(
+        const std::vector<SpriteHandle>& tiles,
+        int width,
+        int height,
+        const Vec2i& origin
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Replace a single cell, marking the layer dirty
+    ///
+    /// \param cell The cell, relative to the layer origin
+    /// \param sprite The new sprite handle
+    ///
+    /// \return The new version of the layer
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::uint32_t SetTile(const Vec2i& cell, SpriteHandle sprite);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Empty the layer
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Clear(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param x The column, relative to the layer origin
+    /// \param y The row, relative to the layer origin
+    ///
+    /// \return The sprite handle of the cell
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    SpriteHandle Get(int x, int y) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return A row-major view over the cells
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Span<const SpriteHandle> GetTiles(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return The grid position of the top left cell
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const Vec2i& GetOrigin(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return The width in cells
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    int GetWidth(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return The height in cells
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    int GetHeight(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return The version, compared by backends to refresh their cache
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::uint32_t GetVersion(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return True if there is nothing to draw
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool IsEmpty(void) const;
+};
+
+} // namespace Arc
@@ -64,6 +64,10 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
+    /// Game modules are constructed on a loader thread, so the constructor
+    /// must not call the API. Seeding with API::NextRandomSeed, like any
+    /// other API call, goes in BeginPlay, which runs on the main thread.
+    ///
     ///////////////////////////////////////////////////////////////////////////
     IGameModule(void) = default;
 
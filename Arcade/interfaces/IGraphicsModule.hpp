@@ -6,6 +6,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
+#include "Arcade/utils/PixelView.hpp"
 #include <string>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -74,6 +75,17 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     virtual void LoadSpriteSheet(const std::string& path) = 0;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Load sprite sheet from pixels decoded by the core
+    ///
+    /// The core calls it instead of LoadSpriteSheet when it could decode
+    /// the sheet. The pixels stay valid while the module is alive.
+    ///
+    /// \param sheet The decoded sprite sheet
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual void LoadSpriteSheetPixels(const PixelView& sheet) = 0;
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Get the name of the library
     ///
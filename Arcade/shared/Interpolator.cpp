@@ -0,0 +1,144 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Arcade/shared/Interpolator.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+Interpolator::Interpolator(float speed, float snapDistance)
+    : mSpeed(speed)
+    , mSnapDistance(snapDistance * snapDistance)
+    , mStarted(false)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+void Interpolator::Advance(void)
+{
+    auto now = std::chrono::steady_clock::now();
+    std::chrono::duration<float> elapsed = now - mLast;
+    float step = mStarted ? elapsed.count() * mSpeed : 0.f;
+
+    mLast = now;
+    mStarted = true;
+
+    for (std::size_t slot = mIds.size(); slot-- > 0;) {
+        if (!mSeen[slot]) {
+            Remove(slot);
+        }
+    }
+
+    std::size_t count = mIds.size();
+    float* currentX = mCurrentX.data();
+    float* currentY = mCurrentY.data();
+    const float* targetX = mTargetX.data();
+    const float* targetY = mTargetY.data();
+    float* factor = mFactor.data();
+    std::uint8_t* seen = mSeen.data();
+
+    for (std::size_t i = 0; i < count; i++) {
+        float next = factor[i] + step;
+        bool done = next >= 1.f;
+
+        factor[i] = done ? 1.f : next;
+        currentX[i] = done ? targetX[i] : currentX[i];
+        currentY[i] = done ? targetY[i] : currentY[i];
+        seen[i] = 0;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Vec2f Interpolator::Track(int id, const Vec2f& target)
+{
+    if (id == -1) {
+        return (target);
+    }
+
+    auto [it, inserted] = mSlots.try_emplace(id, mIds.size());
+    std::size_t slot = it->second;
+
+    if (inserted) {
+        mIds.push_back(id);
+        mCurrentX.push_back(target.x);
+        mCurrentY.push_back(target.y);
+        mTargetX.push_back(target.x);
+        mTargetY.push_back(target.y);
+        mFactor.push_back(1.f);
+        mSeen.push_back(1);
+        return (target);
+    }
+
+    float dx = target.x - mCurrentX[slot];
+    float dy = target.y - mCurrentY[slot];
+
+    mSeen[slot] = 1;
+    if (dx * dx + dy * dy > mSnapDistance) {
+        mCurrentX[slot] = target.x;
+        mCurrentY[slot] = target.y;
+        mTargetX[slot] = target.x;
+        mTargetY[slot] = target.y;
+        mFactor[slot] = 1.f;
+        return (target);
+    }
+
+    if (mTargetX[slot] != target.x || mTargetY[slot] != target.y) {
+        mTargetX[slot] = target.x;
+        mTargetY[slot] = target.y;
+        mFactor[slot] = 0.f;
+    }
+
+    return (Vec2f(
+        mCurrentX[slot] + dx * mFactor[slot],
+        mCurrentY[slot] + dy * mFactor[slot]
+    ));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Interpolator::Clear(void)
+{
+    mSlots.clear();
+    mIds.clear();
+    mCurrentX.clear();
+    mCurrentY.clear();
+    mTargetX.clear();
+    mTargetY.clear();
+    mFactor.clear();
+    mSeen.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t Interpolator::GetSize(void) const
+{
+    return (mIds.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Interpolator::Remove(std::size_t slot)
+{
+    std::size_t last = mIds.size() - 1;
+
+    mSlots.erase(mIds[slot]);
+    if (slot != last) {
+        mIds[slot] = mIds[last];
+        mCurrentX[slot] = mCurrentX[last];
+        mCurrentY[slot] = mCurrentY[last];
+        mTargetX[slot] = mTargetX[last];
+        mTargetY[slot] = mTargetY[last];
+        mFactor[slot] = mFactor[last];
+        mSeen[slot] = mSeen[last];
+        mSlots[mIds[slot]] = slot;
+    }
+    mIds.pop_back();
+    mCurrentX.pop_back();
+    mCurrentY.pop_back();
+    mTargetX.pop_back();
+    mTargetY.pop_back();
+    mFactor.pop_back();
+    mSeen.pop_back();
+}
+
+} // namespace Arc
@@ -0,0 +1,106 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Arcade/utils/Vec2.hpp"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Smooth the movement of drawn entities between two grid positions
+///
+/// Tracks are stored as parallel arrays in a dense slot map: the id map
+/// gives the slot of an entity, and removing a track moves the last one in
+/// its place. Advance walks the arrays once without branching so it can be
+/// vectorized, and Track does a single hash lookup per draw command.
+///
+///////////////////////////////////////////////////////////////////////////////
+class Interpolator
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Member data
+    ///////////////////////////////////////////////////////////////////////////
+    float mSpeed;                               //<! Factor gained per second
+    float mSnapDistance;                        //<! Squared teleport distance
+    std::unordered_map<
+        int, std::size_t
+    > mSlots;                                   //<! Entity id to slot
+    std::vector<int> mIds;                      //<! Entity id of each slot
+    std::vector<float> mCurrentX;               //<! Start of the movement
+    std::vector<float> mCurrentY;               //<! Start of the movement
+    std::vector<float> mTargetX;                //<! End of the movement
+    std::vector<float> mTargetY;                //<! End of the movement
+    std::vector<float> mFactor;                 //<! Progress, from 0 to 1
+    std::vector<std::uint8_t> mSeen;            //<! Tracked since Advance
+    std::chrono::steady_clock::time_point
+        mLast;                                  //<! Time of the last Advance
+    bool mStarted;                              //<! Advance was called once
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor
+    ///
+    /// \param speed The factor gained per second, 10 moves a tile in 100ms
+    /// \param snapDistance Movements longer than this are not smoothed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Interpolator(float speed = 10.f, float snapDistance = 15.f);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Advance every track by the time elapsed since the last call,
+    /// and drop the tracks that were not drawn since then
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Advance(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Update the target of an entity
+    ///
+    /// \param id The entity id of the draw command, -1 is never smoothed
+    /// \param target The position the entity is drawn at this frame
+    ///
+    /// \return The smoothed position to draw the entity at
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Vec2f Track(int id, const Vec2f& target);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Forget every track, when the game changes
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Clear(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the number of tracked entities
+    ///
+    /// \return The number of tracks
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t GetSize(void) const;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Remove a track, moving the last one in its slot
+    ///
+    /// \param slot The slot to remove
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Remove(std::size_t slot);
+};
+
+} // namespace Arc
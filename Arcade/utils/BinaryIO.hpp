@@ -0,0 +1,53 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include <fstream>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Read a value in host byte order
+///
+/// \tparam T A trivially copyable type
+///
+/// \param file The input file
+/// \param value The value to fill
+///
+/// \return True if the value was read completely
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+bool ReadValue(std::ifstream& file, T& value)
+{
+    file.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return (file.gcount() == sizeof(T));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Append a value in host byte order
+///
+/// \tparam T A trivially copyable type
+///
+/// \param buffer The output bytes
+/// \param value The value to append
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void WriteValue(std::vector<char>& buffer, T value)
+{
+    const char* bytes = reinterpret_cast<const char*>(&value);
+
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+} // namespace Arc
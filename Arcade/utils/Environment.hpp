@@ -0,0 +1,59 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include <cctype>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Read an on/off switch from the environment
+///
+/// "1", "on", "true" and "yes" turn it on, "0", "off", "false", "no" and
+/// the empty string turn it off, in any case.
+///
+/// \param name The environment variable
+/// \param fallback The value used when the variable is unset or invalid
+///
+/// \return True if the switch is on
+///
+///////////////////////////////////////////////////////////////////////////////
+inline bool GetFlag(const char* name, bool fallback)
+{
+    const char* value = std::getenv(name);
+
+    if (value == nullptr) {
+        return (fallback);
+    }
+
+    std::string flag(value);
+
+    for (char& c : flag) {
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    if (flag == "1" || flag == "on" || flag == "true" || flag == "yes") {
+        return (true);
+    }
+    if (
+        flag.empty() || flag == "0" || flag == "off" ||
+        flag == "false" || flag == "no"
+    ) {
+        return (false);
+    }
+    std::cerr << "ERROR: Invalid " << name << ", using "
+              << (fallback ? "on" : "off") << " instead." << std::endl;
+    return (fallback);
+}
+
+} // namespace Arc
@@ -0,0 +1,31 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Non-owning view over a decoded image
+///
+/// The pixels are RGBA, one byte per channel, rows packed from top to
+/// bottom.
+///
+///////////////////////////////////////////////////////////////////////////////
+struct PixelView
+{
+    const std::uint8_t* pixels;             //<! width * height * 4 bytes
+    unsigned int width;                     //<! In pixels
+    unsigned int height;                    //<! In pixels
+};
+
+} // namespace Arc
@@ -0,0 +1,169 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include <cassert>
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+//
+///////////////////////////////////////////////////////////////////////////////
+#define ARC_RING_BUFFER_CAPACITY    64
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief First in first out queue over preallocated slots
+///
+/// The capacity is a power of two so positions wrap with a mask. Pushing
+/// never allocates until the queue is full, it then doubles its storage
+/// instead of dropping elements.
+///
+/// \tparam T The element type, it does not need a default constructor
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+class RingBuffer
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Member data
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<std::optional<T>> mSlots;   //<! Power of two slots
+    std::size_t mHead;                      //<! Slot of the oldest element
+    std::size_t mSize;                      //<! Number of elements
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor
+    ///
+    /// \param capacity The number of preallocated slots, rounded up to a
+    /// power of two
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit RingBuffer(std::size_t capacity = ARC_RING_BUFFER_CAPACITY)
+        : mHead(0)
+        , mSize(0)
+    {
+        std::size_t slots = 1;
+
+        while (slots < capacity) {
+            slots <<= 1;
+        }
+        mSlots.resize(slots);
+    }
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Append an element
+    ///
+    /// \param value The element, copied or moved in its slot
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename U>
+    void Push(U&& value)
+    {
+        if (mSize == mSlots.size()) {
+            Grow();
+        }
+        mSlots[(mHead + mSize) & (mSlots.size() - 1)].emplace(
+            std::forward<U>(value)
+        );
+        mSize++;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Remove the oldest element, the queue must not be empty
+    ///
+    /// \return The element, moved out of its slot
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    T Pop(void)
+    {
+        assert(mSize > 0 && "Pop on an empty ring buffer");
+
+        std::optional<T>& slot = mSlots[mHead];
+        T value = std::move(*slot);
+
+        slot.reset();
+        mHead = (mHead + 1) & (mSlots.size() - 1);
+        mSize--;
+        return (value);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Remove every element, keeping the slots
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Clear(void)
+    {
+        while (mSize > 0) {
+            mSlots[mHead].reset();
+            mHead = (mHead + 1) & (mSlots.size() - 1);
+            mSize--;
+        }
+        mHead = 0;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return True if there is no element
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool IsEmpty(void) const
+    {
+        return (mSize == 0);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return The number of elements
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t GetSize(void) const
+    {
+        return (mSize);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return The number of slots
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t GetCapacity(void) const
+    {
+        return (mSlots.size());
+    }
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Double the slots, moving the elements to the front
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Grow(void)
+    {
+        std::vector<std::optional<T>> slots(mSlots.size() * 2);
+
+        for (std::size_t i = 0; i < mSize; i++) {
+            slots[i] = std::move(mSlots[(mHead + i) & (mSlots.size() - 1)]);
+        }
+        mSlots = std::move(slots);
+        mHead = 0;
+    }
+};
+
+} // namespace Arc
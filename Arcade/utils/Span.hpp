@@ -0,0 +1,127 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include <cassert>
+#include <cstddef>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Non-owning view over a contiguous range of elements
+///
+/// \tparam T
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+class Span
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Member data
+    ///////////////////////////////////////////////////////////////////////////
+    T* mData;               //<! First element of the range
+    std::size_t mSize;      //<! Number of elements in the range
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Construct an empty span
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr Span(void)
+        : mData(nullptr)
+        , mSize(0)
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Construct a span over an existing range
+    ///
+    /// \param data First element of the range
+    /// \param size Number of elements in the range
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr Span(T* data, std::size_t size)
+        : mData(data)
+        , mSize(size)
+    {}
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return Pointer to the first element
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr T* Data(void) const
+    {
+        return (mData);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return Number of elements in the span
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr std::size_t Size(void) const
+    {
+        return (mSize);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return True if the span holds no element
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr bool IsEmpty(void) const
+    {
+        return (mSize == 0);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param index
+    ///
+    /// \return The element at the given index
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr T& operator[](std::size_t index) const
+    {
+        assert(index < mSize && "Index is out of bounds");
+        return (mData[index]);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr T* begin(void) const
+    {
+        return (mData);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr T* end(void) const
+    {
+        return (mData + mSize);
+    }
+};
+
+} // namespace Arc
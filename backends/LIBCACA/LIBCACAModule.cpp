@@ -16,8 +16,12 @@ LIBCACAModule::LIBCACAModule(void)
     : mWindow(nullptr)
     , mCanva(nullptr)
     , mSpriteSheet(nullptr)
-    , mInterpolationFactor(0.f)
-    , mLastFrameTime(0)
+    , mBuffer(nullptr)
+    , mDither(nullptr)
+    , mLayer(nullptr)
+    , mLayerVersion(0)
+    , mRenderTime(0)
+    , mRenderFrames(0)
 {
     if (SDL_Init(SDL_INIT_VIDEO) < 0) {
         std::cerr << "Cannot init SDL2" << std::endl;
@@ -41,6 +45,21 @@ LIBCACAModule::LIBCACAModule(void)
 ///////////////////////////////////////////////////////////////////////////////
 LIBCACAModule::~LIBCACAModule(void)
 {
+    if (mRenderFrames > 0) {
+        std::chrono::duration<double, std::milli> average =
+            mRenderTime / mRenderFrames;
+
+        std::cerr << "LIBCACA: " << mRenderFrames << " frames, "
+                  << average.count() << " ms/frame" << std::endl;
+    }
+    if (mDither){
+        caca_free_dither(mDither);
+        mDither = nullptr;
+    }
+    if (mBuffer){
+        SDL_FreeSurface(mBuffer);
+        mBuffer = nullptr;
+    }
     if (mCanva){
         caca_free_canvas(mCanva);
         mCanva = nullptr;
@@ -53,6 +72,10 @@ LIBCACAModule::~LIBCACAModule(void)
         SDL_FreeSurface(mSpriteSheet);
         mSpriteSheet = nullptr;
     }
+    if (mLayer){
+        SDL_FreeSurface(mLayer);
+        mLayer = nullptr;
+    }
     IMG_Quit();
     SDL_Quit();
 }
@@ -150,7 +173,7 @@ void LIBCACAModule::Update(void)
             mWindow = caca_create_display(mCanva);
 
         } else if (event->Is<API::Event::ChangeGame>()){
-            mSpritePositions.clear();
+            mInterpolator.Clear();
         }
     }
     caca_event event;
@@ -182,146 +205,169 @@ void LIBCACAModule::Clear(void)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void LIBCACAModule::Render(void)
+bool LIBCACAModule::ResizeBuffer(void)
 {
-    uint32_t currentTime = caca_get_display_time(mWindow);
-    Uint32 deltaTime = mLastFrameTime ? (currentTime - mLastFrameTime) : 0;
-    mLastFrameTime = currentTime;
-
-    float deltaSeconds = deltaTime / 1000.0f;
-    float speed = 10.0f;
-
-    for (auto& [id, interp] : mSpritePositions) {
-        interp.factor += deltaSeconds * speed;
-        if (interp.factor > 1.0f) {
-            interp.factor = 1.0f;
-            interp.current = interp.target;
-        }
+    int width = caca_get_canvas_width(mCanva);
+    int height = caca_get_canvas_height(mCanva);
+
+    if (mBuffer && mDither && mBuffer->w == width && mBuffer->h == height) {
+        return (true);
+    }
+
+    if (mDither) {
+        caca_free_dither(mDither);
+        mDither = nullptr;
+    }
+    if (mBuffer) {
+        SDL_FreeSurface(mBuffer);
+    }
+
+    mBuffer = SDL_CreateRGBSurfaceWithFormat(
+        0, width, height, 32, SDL_PIXELFORMAT_ARGB8888
+    );
+    if (!mBuffer) {
+        return (false);
+    }
+
+    mDither = caca_create_dither(
+        32,
+        mBuffer->w,
+        mBuffer->h,
+        mBuffer->pitch,
+        mBuffer->format->Rmask,
+        mBuffer->format->Gmask,
+        mBuffer->format->Bmask,
+        mBuffer->format->Amask
+    );
+    if (!mDither) {
+        return (false);
     }
-     int pixelsPerCharX = 1;
-     int pixelsPerCharY = 1;
-     int bufferWidth = caca_get_canvas_width(mCanva) * pixelsPerCharX;
-     int bufferHeight = caca_get_canvas_height(mCanva) * pixelsPerCharY;
-
-     SDL_Surface* bufferSurface = SDL_CreateRGBSurface(
-         SDL_SWSURFACE,
-         bufferWidth,
-         bufferHeight,
-         32,
-         0x00ff0000,
-         0x0000ff00,
-         0x000000ff,
-         0xff000000
-     );
-
-     if (!bufferSurface) return;
-     float scaleX = static_cast<float>(bufferWidth) / mWindowWidth * mRatio;
-     float scaleY = static_cast<float>(bufferHeight) / mWindowHeight * mRatio;
-        SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "2");
-
-    while (!API::IsDrawQueueEmpty()) {
-        auto draw = API::PopDraw();
-        auto [asset, pos, color] = draw;
-        int entityId = asset.id;
-
-        Vec2f targetPos = {
-            pos.x * GRID_TILE_SIZE - (asset.size.x - GRID_TILE_SIZE) / 2.0f,
-            pos.y * GRID_TILE_SIZE - (asset.size.y - GRID_TILE_SIZE) / 2.0f
-        };
-
-        if (
-            entityId == -1 ||
-            mSpritePositions.find(entityId) == mSpritePositions.end()
-        ) {
-            mSpritePositions[entityId] = {targetPos, targetPos, 1.0f};
-        } else {
-            float length = std::sqrt(
-                std::pow(targetPos.x - mSpritePositions[entityId].current.x, 2) +
-                std::pow(targetPos.y - mSpritePositions[entityId].current.y, 2)
-            );
 
-            if (length > 15.f) {
-                mSpritePositions[entityId].target = targetPos;
-                mSpritePositions[entityId].current = targetPos;
-                mSpritePositions[entityId].factor = 1.0f;
-            } else if (mSpritePositions[entityId].target.x != targetPos.x ||
-                mSpritePositions[entityId].target.y != targetPos.y) {
-                mSpritePositions[entityId].target = targetPos;
-                mSpritePositions[entityId].factor = 0.0f;
+    caca_set_dither_algorithm(mDither, "fstein");
+    caca_set_dither_color(mDither, "rgb");
+
+    caca_set_dither_brightness(mDither, 0.8f);
+    caca_set_dither_gamma(mDither, 1.0f);
+    caca_set_dither_contrast(mDither, 0.8f);
+    // caca_set_dither_charset()
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void LIBCACAModule::RenderLayer(
+    SDL_Surface* buffer,
+    float scaleX,
+    float scaleY
+)
+{
+    const TileLayer& layer = API::GetLayer();
+
+    if (layer.IsEmpty() || !mSpriteSheet) {
+        return;
+    }
+
+    if (mLayer && (mLayer->w != buffer->w || mLayer->h != buffer->h)) {
+        SDL_FreeSurface(mLayer);
+        mLayer = nullptr;
+    }
+
+    if (!mLayer || layer.GetVersion() != mLayerVersion) {
+        if (!mLayer) {
+            mLayer = SDL_CreateRGBSurfaceWithFormat(
+                0, buffer->w, buffer->h, 32, SDL_PIXELFORMAT_ARGB8888
+            );
+        }
+        if (!mLayer) {
+            return;
+        }
+        SDL_FillRect(mLayer, NULL, 0);
+
+        Span<const Sprite> sprites = API::GetSprites();
+        const Vec2i& origin = layer.GetOrigin();
+
+        for (int y = 0; y < layer.GetHeight(); y++) {
+            for (int x = 0; x < layer.GetWidth(); x++) {
+                const Sprite& sprite = sprites[layer.Get(x, y)];
+                float posX = (origin.x + x) * GRID_TILE_SIZE -
+                    (sprite.size.x - GRID_TILE_SIZE) / 2.0f;
+                float posY = (origin.y + y) * GRID_TILE_SIZE -
+                    (sprite.size.y - GRID_TILE_SIZE) / 2.0f;
+
+                SDL_Rect srcRect;
+                srcRect.x = sprite.atlas.x * GRID_TILE_SIZE;
+                srcRect.y = sprite.atlas.y * GRID_TILE_SIZE;
+                srcRect.w = sprite.size.x;
+                srcRect.h = sprite.size.y;
+
+                SDL_Rect destRect;
+                destRect.x = static_cast<int>(posX * scaleX);
+                destRect.y = static_cast<int>(posY * scaleY);
+                destRect.w = static_cast<int>(sprite.size.x * scaleX);
+                destRect.h = static_cast<int>(sprite.size.y * scaleY);
+                SDL_BlitScaled(mSpriteSheet, &srcRect, mLayer, &destRect);
             }
         }
+        mLayerVersion = layer.GetVersion();
+    }
 
-        Vec2f currentPos = mSpritePositions[entityId].current;
-        Vec2f interpolatedPos = {
-            currentPos.x + (targetPos.x - currentPos.x) *
-                mSpritePositions[entityId].factor,
-            currentPos.y + (targetPos.y - currentPos.y) *
-                mSpritePositions[entityId].factor
-        };
-
-        SDL_Surface *spriteSurface = SDL_CreateRGBSurface(
-            SDL_SWSURFACE,
-            asset.size.x,
-            asset.size.y,
-            32,
-            0x00ff0000,
-            0x0000ff00,
-            0x000000ff,
-            0xff000000
-        );
-        if (!spriteSurface) return;
+    SDL_BlitSurface(mLayer, NULL, buffer, NULL);
+}
 
-        SDL_Rect srcRect;
-        srcRect.x = asset.position.x * GRID_TILE_SIZE;
-        srcRect.y = asset.position.y * GRID_TILE_SIZE;
-        srcRect.w = asset.size.x;
-        srcRect.h = asset.size.y;
+///////////////////////////////////////////////////////////////////////////////
+void LIBCACAModule::Render(void)
+{
+    auto renderStart = std::chrono::steady_clock::now();
+    mInterpolator.Advance();
+
+    if (!mSpriteSheet || !ResizeBuffer()) {
+        caca_refresh_display(mWindow);
+        return;
+    }
+
+    SDL_Surface* bufferSurface = mBuffer;
+    float scaleX = bufferSurface->w / mWindowWidth * mRatio;
+    float scaleY = bufferSurface->h / mWindowHeight * mRatio;
 
-        SDL_BlitSurface(mSpriteSheet, &srcRect, spriteSurface, NULL);
+    SDL_FillRect(bufferSurface, NULL, 0);
+    RenderLayer(bufferSurface, scaleX, scaleY);
+
+    Span<const Sprite> sprites = API::GetSprites();
+
+    for (const DrawCommand& draw : API::GetDrawCommands()) {
+        const Sprite& sprite = sprites[draw.sprite];
+        Vec2f interpolatedPos = mInterpolator.Track(draw.id, Vec2f(
+            draw.position.x * GRID_TILE_SIZE -
+                (sprite.size.x - GRID_TILE_SIZE) / 2.0f,
+            draw.position.y * GRID_TILE_SIZE -
+                (sprite.size.y - GRID_TILE_SIZE) / 2.0f
+        ));
+
+        SDL_Rect srcRect;
+        srcRect.x = sprite.atlas.x * GRID_TILE_SIZE;
+        srcRect.y = sprite.atlas.y * GRID_TILE_SIZE;
+        srcRect.w = sprite.size.x;
+        srcRect.h = sprite.size.y;
 
         SDL_Rect destRect;
         destRect.x = static_cast<int>(interpolatedPos.x * scaleX);
         destRect.y = static_cast<int>(interpolatedPos.y * scaleY);
-        destRect.w = static_cast<int>(asset.size.x * scaleX);
-        destRect.h = static_cast<int>(asset.size.y * scaleY);
+        destRect.w = static_cast<int>(sprite.size.x * scaleX);
+        destRect.h = static_cast<int>(sprite.size.y * scaleY);
         SDL_BlitScaled(mSpriteSheet, &srcRect, bufferSurface, &destRect);
-        SDL_FreeSurface(spriteSurface);
-
     }
 
-    caca_dither_t* dither = caca_create_dither(
-        32,
-        bufferSurface->w,
-        bufferSurface->h,
-        bufferSurface->pitch,
-        bufferSurface->format->Rmask,
-        bufferSurface->format->Gmask,
-        bufferSurface->format->Bmask,
-        bufferSurface->format->Amask
+    caca_dither_bitmap(
+        mCanva,
+        0, 0,
+        caca_get_canvas_width(mCanva),
+        caca_get_canvas_height(mCanva),
+        mDither,
+        bufferSurface->pixels
     );
-
-    if (dither) {
-        caca_set_dither_algorithm(dither, "fstein");
-        caca_set_dither_color(dither, "rgb");
-
-        caca_set_dither_brightness(dither, 0.8f);
-        caca_set_dither_gamma(dither, 1.0f);
-        caca_set_dither_contrast(dither, 0.8f);
-        // caca_set_dither_charset()
-        caca_dither_bitmap(
-            mCanva,
-            0, 0,
-            caca_get_canvas_width(mCanva),
-            caca_get_canvas_height(mCanva),
-            dither,
-            bufferSurface->pixels
-        );
-
-        caca_free_dither(dither);
-    }
-
-    SDL_FreeSurface(bufferSurface);
     caca_refresh_display(mWindow);
+
+    mRenderTime += std::chrono::steady_clock::now() - renderStart;
+    mRenderFrames++;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -331,15 +377,51 @@ void LIBCACAModule::SetTitle(const std::string& title)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void LIBCACAModule::LoadSpriteSheet(const std::string& path)
+void LIBCACAModule::SetSpriteSheet(SDL_Surface* image)
 {
-    if (!mCanva) return;
+    if (mSpriteSheet) {
+        SDL_FreeSurface(mSpriteSheet);
+    }
+    mLayerVersion = 0;
+    mSpriteSheet = nullptr;
 
-    mSpriteSheet = IMG_Load(path.c_str());
+    if (!image){
+        std::cerr << "not loaded";
+        return;
+    }
+
+    // Convert once to the format of the frame buffer so the blits in
+    // Render never have to convert pixels
+    mSpriteSheet = SDL_ConvertSurfaceFormat(
+        image, SDL_PIXELFORMAT_ARGB8888, 0
+    );
+    SDL_FreeSurface(image);
     if (!mSpriteSheet){
         std::cerr << "not loaded";
         return;
     }
+    SDL_SetSurfaceBlendMode(mSpriteSheet, SDL_BLENDMODE_BLEND);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void LIBCACAModule::LoadSpriteSheet(const std::string& path)
+{
+    if (!mCanva) return;
+
+    SetSpriteSheet(IMG_Load(path.c_str()));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void LIBCACAModule::LoadSpriteSheetPixels(const PixelView& sheet)
+{
+    if (!mCanva) return;
+
+    // The surface only borrows the pixels, they are copied by the
+    // conversion
+    SetSpriteSheet(SDL_CreateRGBSurfaceWithFormatFrom(
+        const_cast<std::uint8_t*>(sheet.pixels), sheet.width, sheet.height,
+        32, sheet.width * 4, SDL_PIXELFORMAT_RGBA32
+    ));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
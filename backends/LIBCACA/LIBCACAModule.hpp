@@ -8,6 +8,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "Arcade/interfaces/IGraphicsModule.hpp"
 #include "Arcade/enums/Inputs.hpp"
+#include "Arcade/shared/Interpolator.hpp"
 #include <caca.h>
 #include <iostream>
 #include <thread>
@@ -30,33 +31,24 @@ namespace Arc
 ///////////////////////////////////////////////////////////////////////////////
 class LIBCACAModule : public IGraphicsModule
 {
-private:
-    ///////////////////////////////////////////////////////////////////////////
-    /// \brief
-    ///
-    ///////////////////////////////////////////////////////////////////////////
-    struct EntityInterpolation
-    {
-        Vec2f current;
-        Vec2f target;
-        float factor;
-    };
-
 private:
     ///////////////////////////////////////////////////////////////////////////
     // Data members
     ///////////////////////////////////////////////////////////////////////////
     caca_display_t *mWindow;                    //<! The window/canva
     caca_canvas_t *mCanva;                      //<! The Renderer
-    SDL_Surface *mSpriteSheet;                  //<! The texture
+    SDL_Surface *mSpriteSheet;                  //<! Sheet in buffer format
     SDL_Surface *rgbImage;                      //<! rgb value of image
+    SDL_Surface *mBuffer;                       //<! Frame, canvas sized
+    caca_dither_t *mDither;                     //<! Dither of mBuffer
+    SDL_Surface *mLayer;                        //<! Prerendered tile layer
+    uint32_t mLayerVersion;                     //<! Version of mLayer
+    std::chrono::steady_clock::duration
+        mRenderTime;                            //<! Time spent in Render
+    uint64_t mRenderFrames;                     //<! Frames rendered
     float mRatio;                               //<! The scaling ratio
     float mCanvaRatio;                          //<! The canva scaling ratio
-    std::unordered_map<
-        int, EntityInterpolation
-    > mSpritePositions;                         //<!
-    float mInterpolationFactor;                 //<!
-    uint32_t mLastFrameTime;                    //<!
+    Interpolator mInterpolator;                 //<! Smoothed entities
     float mWindowWidth;                         //<!
     float mWindowHeight;                        //<!
 
@@ -94,6 +86,34 @@ private:
     ///////////////////////////////////////////////////////////////////////////
     EMouseButton GetMousePress(int click);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Create the frame buffer and its dither again when the canvas
+    /// size changed, they are kept between frames otherwise
+    ///
+    /// \return True if the buffer and the dither are usable
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool ResizeBuffer(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Blit the static tile layer, prerendering it again only when
+    /// the layer or the buffer size changed
+    ///
+    /// \param buffer The frame buffer
+    /// \param scaleX The horizontal pixel scale of the buffer
+    /// \param scaleY The vertical pixel scale of the buffer
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void RenderLayer(SDL_Surface* buffer, float scaleX, float scaleY);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Convert a sprite sheet to the frame buffer format and use it
+    ///
+    /// \param image The sprite sheet, freed here, nullptr if not loaded
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void SetSpriteSheet(SDL_Surface* image);
+
 public:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Update the graphics module
@@ -129,6 +149,14 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     virtual void LoadSpriteSheet(const std::string& path) override;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Load sprite sheet from decoded pixels
+    ///
+    /// \param sheet The decoded sprite sheet
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual void LoadSpriteSheetPixels(const PixelView& sheet) override;
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Get the name of the library
     ///
@@ -2,8 +2,18 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "backends/NCURSES/NCURSESModule.hpp"
+#include "Arcade/core/ModuleDescriptor.hpp"
 #include <memory>
 
+///////////////////////////////////////////////////////////////////////////////
+// Module descriptor
+///////////////////////////////////////////////////////////////////////////////
+ARC_MODULE_DESCRIPTOR(
+    Arc::MODULE_GRAPHICS, "NCURSES",
+    "",
+    ARC_MODULE_TERMINAL
+);
+
 ///////////////////////////////////////////////////////////////////////////////
 // Extern C
 ///////////////////////////////////////////////////////////////////////////////
@@ -19,7 +29,7 @@ std::unique_ptr<Arc::IGraphicsModule> CreateArcadeObject(void)
 ///////////////////////////////////////////////////////////////////////////////
 std::string GetGraphicsName(void)
 {
-    return ("NCURSES");
+    return (ArcadeModuleDescriptor.name);
 }
 
 }
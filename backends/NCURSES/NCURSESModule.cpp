@@ -4,6 +4,7 @@
 #include "backends/NCURSES/NCURSESModule.hpp"
 #include "Arcade/core/API.hpp"
 #include "Arcade/errors/GraphicalException.hpp"
+#include <algorithm>
 #include <iostream>
 #include <cerrno>
 #include <cstring>
@@ -20,6 +21,8 @@ NCURSESModule::NCURSESModule(void)
     , mHasColor(false)
     , mWidth(80)
     , mHeight(24)
+    , mLayerVersion(0)
+    , mPairClock(0)
 {
     initscr();
 
@@ -56,9 +59,16 @@ NCURSESModule::NCURSESModule(void)
     if (mHasColor) {
         start_color();
         use_default_colors();
+
+        int pairs = std::min(COLOR_PAIRS, COLORS);
+        mPairColors.assign(std::max(pairs, 1), 0);
+        mPairUses.assign(std::max(pairs, 1), 0);
+        mColorPairs.reserve(mPairColors.size());
     }
 
     mousemask(ALL_MOUSE_EVENTS, nullptr);
+    box(mWindow, 0, 0);
+    ResetCells();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -157,6 +167,7 @@ void NCURSESModule::Update(void)
             curs_set(0);
 
             box(mWindow, 0, 0);
+            ResetCells();
         }
     }
 
@@ -192,66 +203,215 @@ void NCURSESModule::Update(void)
 ///////////////////////////////////////////////////////////////////////////////
 void NCURSESModule::Clear(void)
 {
-    werase(mWindow);
+    // Nothing to erase, Render rebuilds the frame in the shadow grid and
+    // only sends the cells that changed
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void NCURSESModule::Render(void)
+bool NCURSESModule::Cell::operator==(const Cell& other) const
 {
-    static int colorPairCounter = 1;
-    std::map<std::tuple<short, short, short>, int> colorPairMap;
+    return (
+        length == other.length &&
+        pair == other.pair &&
+        memcmp(glyph, other.glyph, length) == 0
+    );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool NCURSESModule::Cell::operator!=(const Cell& other) const
+{
+    return (!(*this == other));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void NCURSESModule::ResetCells(void)
+{
+    Cell blank = {{' '}, 1, 0};
+    Cell unknown = {{0}, 0, 0};
+    std::size_t size = static_cast<std::size_t>(mWidth * mHeight);
+
+    mFrame.assign(size, blank);
+    mLayer.assign(size, blank);
+    mScreen.assign(size, unknown);
+    mLayerVersion = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+short NCURSESModule::GetColorPair(const Color& color)
+{
+    if (!mHasColor || mPairColors.size() < 2) {
+        return (0);
+    }
+
+    std::uint32_t key =
+        (static_cast<std::uint32_t>(color.r & 0xff) << 16) |
+        (static_cast<std::uint32_t>(color.g & 0xff) << 8) |
+        static_cast<std::uint32_t>(color.b & 0xff);
 
-    colorPairMap.clear();
-    colorPairCounter = 1;
+    auto it = mColorPairs.find(key);
+    if (it != mColorPairs.end()) {
+        mPairUses[it->second] = ++mPairClock;
+        return (it->second);
+    }
 
-    while (!API::IsDrawQueueEmpty()) {
-        auto draw = API::PopDraw();
-        auto [asset, pos, color] = draw;
+    short pair = 1;
+    for (std::size_t i = 2; i < mPairUses.size(); i++) {
+        if (mPairUses[i] < mPairUses[pair]) {
+            pair = static_cast<short>(i);
+        }
+    }
 
-        if (mHasColor) {
-            short r = asset.color.r;
-            short g = asset.color.g;
-            short b = asset.color.b;
+    if (mPairUses[pair] != 0) {
+        mColorPairs.erase(mPairColors[pair]);
+        for (Cell& cell : mScreen) {
+            if (cell.pair == pair) {
+                cell.length = 0;
+            }
+        }
+        mLayerVersion = 0;
+    }
 
-            auto colorKey = std::make_tuple(r, g, b);
+    short ncursesR = (color.r * 1000) / 255;
+    short ncursesG = (color.g * 1000) / 255;
+    short ncursesB = (color.b * 1000) / 255;
 
-            int colorPairIndex;
-            auto it = colorPairMap.find(colorKey);
-            if (it == colorPairMap.end()) {
-                if (colorPairCounter >= COLOR_PAIRS) {
-                    colorPairCounter = 1;
-                }
+    init_color(pair, ncursesR, ncursesG, ncursesB);
+    init_pair(pair, pair, -1);
 
-                short ncursesR = (r * 1000) / 255;
-                short ncursesG = (g * 1000) / 255;
-                short ncursesB = (b * 1000) / 255;
+    mColorPairs[key] = pair;
+    mPairColors[pair] = key;
+    mPairUses[pair] = ++mPairClock;
+    return (pair);
+}
 
-                init_color(colorPairCounter, ncursesR, ncursesG, ncursesB);
-                init_pair(colorPairCounter, colorPairCounter, -1);
+///////////////////////////////////////////////////////////////////////////////
+void NCURSESModule::PutGlyph(
+    std::vector<Cell>& cells,
+    int y,
+    int x,
+    const Sprite& sprite
+)
+{
+    if (y < 1 || y >= mHeight - 1) {
+        return;
+    }
+
+    short pair = GetColorPair(sprite.color);
+    const char* glyph = sprite.glyph;
+
+    while (*glyph && x < mWidth - 1) {
+        unsigned char lead = static_cast<unsigned char>(*glyph);
+        int length = 1;
+
+        if (lead >= 0xf0) {
+            length = 4;
+        } else if (lead >= 0xe0) {
+            length = 3;
+        } else if (lead >= 0xc0) {
+            length = 2;
+        }
 
-                colorPairMap[colorKey] = colorPairCounter;
-                colorPairIndex = colorPairCounter;
+        if (x >= 1) {
+            Cell& cell = cells[y * mWidth + x];
 
-                colorPairCounter++;
-            } else {
-                colorPairIndex = it->second;
+            memset(cell.glyph, 0, sizeof(cell.glyph));
+            for (int i = 0; i < length && glyph[i]; i++) {
+                cell.glyph[i] = glyph[i];
+                cell.length = static_cast<unsigned char>(i + 1);
             }
+            cell.pair = pair;
+        }
 
-            wattron(mWindow, COLOR_PAIR(colorPairIndex));
-            mvwprintw(mWindow,
-                pos.y + 1, (pos.x * 2) + 1,
-                asset.characters.c_str()
-            );
-            wattroff(mWindow, COLOR_PAIR(colorPairIndex));
-        } else {
-            mvwprintw(mWindow,
-                pos.y + 1, (pos.x * 2) + 1,
-                asset.characters.c_str()
+        for (int i = 0; i < length && *glyph; i++) {
+            glyph++;
+        }
+        x++;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void NCURSESModule::RefreshLayer(void)
+{
+    const TileLayer& layer = API::GetLayer();
+
+    if (layer.GetVersion() == mLayerVersion) {
+        return;
+    }
+
+    Cell blank = {{' '}, 1, 0};
+    Span<const Sprite> sprites = API::GetSprites();
+    const Vec2i& origin = layer.GetOrigin();
+
+    std::fill(mLayer.begin(), mLayer.end(), blank);
+    mLayerVersion = layer.GetVersion();
+    for (int y = 0; y < layer.GetHeight(); y++) {
+        for (int x = 0; x < layer.GetWidth(); x++) {
+            PutGlyph(
+                mLayer,
+                origin.y + y + 1, (origin.x + x) * 2 + 1,
+                sprites[layer.Get(x, y)]
             );
         }
     }
+}
 
-    box(mWindow, 0, 0);
+///////////////////////////////////////////////////////////////////////////////
+void NCURSESModule::FlushCells(void)
+{
+    for (int y = 1; y < mHeight - 1; y++) {
+        int x = 1;
+
+        while (x < mWidth - 1) {
+            std::size_t index = y * mWidth + x;
+
+            if (mFrame[index] == mScreen[index]) {
+                x++;
+                continue;
+            }
+
+            int start = x;
+            short pair = mFrame[index].pair;
+
+            mRun.clear();
+            while (x < mWidth - 1 &&
+                mFrame[index] != mScreen[index] &&
+                mFrame[index].pair == pair
+            ) {
+                mRun.append(mFrame[index].glyph, mFrame[index].length);
+                mScreen[index] = mFrame[index];
+                index++;
+                x++;
+            }
+
+            if (pair != 0) {
+                wattron(mWindow, COLOR_PAIR(pair));
+            }
+            mvwaddnstr(mWindow, y, start, mRun.data(), mRun.size());
+            if (pair != 0) {
+                wattroff(mWindow, COLOR_PAIR(pair));
+            }
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void NCURSESModule::Render(void)
+{
+    Span<const Sprite> sprites = API::GetSprites();
+
+    RefreshLayer();
+    std::copy(mLayer.begin(), mLayer.end(), mFrame.begin());
+
+    for (const DrawCommand& draw : API::GetDrawCommands()) {
+        PutGlyph(
+            mFrame,
+            static_cast<int>(draw.position.y) + 1,
+            static_cast<int>(draw.position.x * 2) + 1,
+            sprites[draw.sprite]
+        );
+    }
+
+    FlushCells();
     wrefresh(mWindow);
 }
 
@@ -267,6 +427,12 @@ void NCURSESModule::LoadSpriteSheet(const std::string& path)
     (void)path;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void NCURSESModule::LoadSpriteSheetPixels(const PixelView& sheet)
+{
+    (void)sheet;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 std::string NCURSESModule::GetName(void) const
 {
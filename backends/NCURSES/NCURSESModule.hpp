@@ -7,10 +7,15 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "Arcade/interfaces/IGraphicsModule.hpp"
+#include "Arcade/core/SpriteRegistry.hpp"
 #include "Arcade/enums/Inputs.hpp"
+#include "Arcade/utils/Color.hpp"
 #include <ncurses.h>
+#include <cstdint>
 #include <memory>
-#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Arc
@@ -24,14 +29,40 @@ namespace Arc
 ///////////////////////////////////////////////////////////////////////////////
 class NCURSESModule : public IGraphicsModule
 {
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief One terminal column of the shadow grid
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Cell
+    {
+        char glyph[4];                  //<! UTF-8 bytes of the column
+        unsigned char length;           //<! Bytes in glyph, 0 if unknown
+        short pair;                     //<! Color pair
+
+        bool operator==(const Cell& other) const;
+        bool operator!=(const Cell& other) const;
+    };
+
 private:
     ///////////////////////////////////////////////////////////////////////////
     // Data members
     ///////////////////////////////////////////////////////////////////////////
-    WINDOW* mWindow;            //<!
-    bool mHasColor;             //<!
-    int mWidth;                 //<!
-    int mHeight;                //<!
+    WINDOW* mWindow;                    //<!
+    bool mHasColor;                     //<!
+    int mWidth;                         //<!
+    int mHeight;                        //<!
+    std::vector<Cell> mFrame;           //<! Cells composed this frame
+    std::vector<Cell> mScreen;          //<! Cells shown on the terminal
+    std::vector<Cell> mLayer;           //<! Cells of the static tile layer
+    std::uint32_t mLayerVersion;        //<! Tile layer version of mLayer
+    std::unordered_map<
+        std::uint32_t, short
+    > mColorPairs;                      //<! Color pair of each glyph color
+    std::vector<std::uint32_t> mPairColors; //<! Glyph color of each pair
+    std::vector<std::uint64_t> mPairUses;   //<! Last use of each pair
+    std::uint64_t mPairClock;           //<! Incremented on every lookup
+    std::string mRun;                   //<! Bytes of the run being written
 
 public:
     ///////////////////////////////////////////////////////////////////////////
@@ -57,6 +88,55 @@ private:
     ///////////////////////////////////////////////////////////////////////////
     EKeyboardKey MapNCursesKey(int key);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Size the shadow grid after the window, forcing a full repaint
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void ResetCells(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the color pair of a glyph color
+    ///
+    /// Pairs persist across frames. When they run out, the least recently
+    /// used one is redefined and the cells showing it are repainted.
+    ///
+    /// \param color The glyph color
+    ///
+    /// \return The color pair index
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    short GetColorPair(const Color& color);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Write the glyph of a sprite in a cell grid, one code point per
+    /// column, clipped to the inside of the border
+    ///
+    /// \param cells The destination grid
+    /// \param y The row
+    /// \param x The column
+    /// \param sprite The sprite
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void PutGlyph(
+        std::vector<Cell>& cells,
+        int y,
+        int x,
+        const Sprite& sprite
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Rebuild the cells of the static tile layer when it changed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void RefreshLayer(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Write the cells that differ from the terminal, in runs of
+    /// adjacent cells sharing a color pair
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void FlushCells(void);
+
 public:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -92,6 +172,14 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     virtual void LoadSpriteSheet(const std::string& path) override;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param sheet
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual void LoadSpriteSheetPixels(const PixelView& sheet) override;
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Get the name of the library
     ///
@@ -0,0 +1,35 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "backends/NULL/NULLModule.hpp"
+#include "Arcade/core/ModuleDescriptor.hpp"
+#include <memory>
+
+///////////////////////////////////////////////////////////////////////////////
+// Module descriptor
+///////////////////////////////////////////////////////////////////////////////
+ARC_MODULE_DESCRIPTOR(
+    Arc::MODULE_GRAPHICS, "NULL",
+    "",
+    ARC_MODULE_HIDDEN
+);
+
+///////////////////////////////////////////////////////////////////////////////
+// Extern C
+///////////////////////////////////////////////////////////////////////////////
+extern "C"
+{
+
+///////////////////////////////////////////////////////////////////////////////
+std::unique_ptr<Arc::IGraphicsModule> CreateArcadeObject(void)
+{
+    return (std::make_unique<Arc::NULLModule>());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::string GetGraphicsName(void)
+{
+    return (ArcadeModuleDescriptor.name);
+}
+
+}
@@ -0,0 +1,314 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "backends/NULL/NULLModule.hpp"
+#include "Arcade/enums/Inputs.hpp"
+#include "Arcade/utils/Environment.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Script names of the keys, in EKeyboardKey order
+///
+///////////////////////////////////////////////////////////////////////////////
+static const char* KEY_NAMES[] = {
+    "A", "B", "C", "D", "E", "F", "G", "H", "I", "J", "K", "L", "M",
+    "N", "O", "P", "Q", "R", "S", "T", "U", "V", "W", "X", "Y", "Z",
+    "UP", "DOWN", "LEFT", "RIGHT",
+    "SPACE", "ENTER", "ESCAPE", "BACKSPACE",
+    "0", "1", "2", "3", "4", "5", "6", "7", "8", "9"
+};
+
+///////////////////////////////////////////////////////////////////////////////
+static_assert(
+    sizeof(KEY_NAMES) / sizeof(*KEY_NAMES) ==
+        static_cast<std::size_t>(EKeyboardKey::UNKNOWN),
+    "KEY_NAMES must name every key"
+);
+
+///////////////////////////////////////////////////////////////////////////////
+NULLModule::NULLModule(void)
+    : mNextEvent(0)
+    , mFrame(0)
+    , mFrameLimit(0)
+    , mTotals{0, 0, 0, 0}
+    , mBlit(false)
+    , mWidth(0)
+    , mHeight(0)
+    , mLayerVersion(0)
+{
+    const char* script = std::getenv("ARCADE_NULL_INPUT");
+    const char* frames = std::getenv("ARCADE_NULL_FRAMES");
+    const char* stats = std::getenv("ARCADE_NULL_STATS");
+
+    if (script != nullptr) {
+        ParseScript(script);
+    }
+    if (frames != nullptr) {
+        mFrameLimit = std::strtoull(frames, nullptr, 10);
+    }
+    mBlit = GetFlag("ARCADE_NULL_FRAMEBUFFER", false);
+    if (stats != nullptr) {
+        mStats.emplace(stats, std::ios::trunc);
+        if (!*mStats) {
+            std::cerr << "NULL: cannot write " << stats << std::endl;
+            mStats.reset();
+        } else {
+            *mStats << "frame,draws,unique_sprites,bytes\n";
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+NULLModule::~NULLModule()
+{
+    double frames = static_cast<double>(std::max<std::uint64_t>(mFrame, 1));
+
+    std::cerr << "NULL: " << mFrame << " frames, "
+              << mTotals.draws / frames << " draws/frame (max "
+              << mTotals.maxDraws << "), "
+              << mTotals.uniqueSprites / frames << " unique sprites/frame, "
+              << mTotals.bytes / frames << " bytes/frame" << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void NULLModule::ParseScript(const std::string& script)
+{
+    std::istringstream stream(script);
+    std::string item;
+
+    while (std::getline(stream, item, ',')) {
+        std::size_t colon = item.find(':');
+
+        if (colon == std::string::npos) {
+            std::cerr << "NULL: ignoring input " << item << std::endl;
+            continue;
+        }
+
+        std::uint64_t frame = std::strtoull(item.c_str(), nullptr, 10);
+        std::string name = item.substr(colon + 1);
+
+        if (name == "CLOSE") {
+            mScript.push_back({frame, API::Event::Closed()});
+            continue;
+        }
+
+        const char** key = std::find_if(
+            std::begin(KEY_NAMES), std::end(KEY_NAMES),
+            [&name](const char* known) { return (name == known); }
+        );
+
+        if (key == std::end(KEY_NAMES)) {
+            std::cerr << "NULL: unknown key " << name << std::endl;
+            continue;
+        }
+        mScript.push_back({frame, API::Event::KeyPressed{
+            static_cast<EKeyboardKey>(key - std::begin(KEY_NAMES))
+        }});
+    }
+    std::stable_sort(
+        mScript.begin(), mScript.end(),
+        [](const ScriptedEvent& a, const ScriptedEvent& b) {
+            return (a.frame < b.frame);
+        }
+    );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void NULLModule::ResizeFrameBuffer(int width, int height)
+{
+    mWidth = width * GRID_TILE_SIZE;
+    mHeight = height * GRID_TILE_SIZE;
+    if (mBlit) {
+        mFrameBuffer.assign(mWidth * mHeight, 0);
+    }
+    mLayer.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t NULLModule::Blit(
+    std::vector<std::uint32_t>& target,
+    const Sprite& sprite,
+    int x,
+    int y
+) const
+{
+    if (!mSheet) {
+        return (0);
+    }
+
+    int left = x - sprite.size.x / 2;
+    int top = y - sprite.size.y / 2;
+    int sheetX = sprite.atlas.x * GRID_TILE_SIZE;
+    int sheetY = sprite.atlas.y * GRID_TILE_SIZE;
+    int sheetWidth = static_cast<int>(mSheet->width);
+    int sheetHeight = static_cast<int>(mSheet->height);
+    std::uint64_t written = 0;
+
+    for (int row = 0; row < sprite.size.y; row++) {
+        int targetY = top + row;
+        int sourceY = sheetY + row;
+
+        if (
+            targetY < 0 || targetY >= mHeight ||
+            sourceY < 0 || sourceY >= sheetHeight
+        ) {
+            continue;
+        }
+        for (int column = 0; column < sprite.size.x; column++) {
+            int targetX = left + column;
+            int sourceX = sheetX + column;
+
+            if (
+                targetX < 0 || targetX >= mWidth ||
+                sourceX < 0 || sourceX >= sheetWidth
+            ) {
+                continue;
+            }
+
+            const std::uint8_t* pixel =
+                mSheet->pixels + (sourceY * sheetWidth + sourceX) * 4;
+
+            if (pixel[3] == 0) {
+                continue;
+            }
+            std::memcpy(&target[targetY * mWidth + targetX], pixel, 4);
+            written += 4;
+        }
+    }
+    return (written);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t NULLModule::RefreshLayer(void)
+{
+    const TileLayer& layer = API::GetLayer();
+
+    if (!mLayer.empty() && layer.GetVersion() == mLayerVersion) {
+        return (0);
+    }
+
+    int half = GRID_TILE_SIZE / 2;
+    const Vec2i& origin = layer.GetOrigin();
+    Span<const Sprite> sprites = API::GetSprites();
+    std::uint64_t written = 0;
+
+    mLayer.assign(mFrameBuffer.size(), 0);
+    mLayerVersion = layer.GetVersion();
+    if (layer.IsEmpty()) {
+        return (0);
+    }
+    for (int y = 0; y < layer.GetHeight(); y++) {
+        for (int x = 0; x < layer.GetWidth(); x++) {
+            written += Blit(
+                mLayer, sprites[layer.Get(x, y)],
+                (origin.x + x) * GRID_TILE_SIZE + half,
+                (origin.y + y) * GRID_TILE_SIZE + half
+            );
+        }
+    }
+    return (written);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void NULLModule::Update(void)
+{
+    while (auto event = API::PollEvent(API::Event::GRAPHICS)) {
+        if (auto gridSize = event->GetIf<API::Event::GridSize>()) {
+            ResizeFrameBuffer(gridSize->width, gridSize->height);
+        }
+    }
+
+    while (mNextEvent < mScript.size() && mScript[mNextEvent].frame <= mFrame) {
+        API::PushEvent(API::Event::CORE, mScript[mNextEvent].event);
+        mNextEvent++;
+    }
+    if (mFrameLimit != 0 && mFrame >= mFrameLimit) {
+        API::PushEvent(API::Event::CORE, API::Event::Closed());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void NULLModule::Clear(void)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+void NULLModule::Render(void)
+{
+    Span<const DrawCommand> draws = API::GetDrawCommands();
+    Span<const Sprite> sprites = API::GetSprites();
+    std::uint64_t bytes = draws.Size() * sizeof(DrawCommand);
+    std::uint64_t unique = 0;
+    int half = GRID_TILE_SIZE / 2;
+
+    mFrame++;
+    if (mSeen.size() < sprites.Size()) {
+        mSeen.resize(sprites.Size(), 0);
+    }
+    if (mBlit && !mFrameBuffer.empty()) {
+        bytes += RefreshLayer();
+        std::copy(mLayer.begin(), mLayer.end(), mFrameBuffer.begin());
+        bytes += mFrameBuffer.size() * sizeof(std::uint32_t);
+    }
+
+    for (const DrawCommand& draw : draws) {
+        if (mSeen[draw.sprite] != mFrame) {
+            mSeen[draw.sprite] = mFrame;
+            unique++;
+        }
+        if (mBlit && !mFrameBuffer.empty()) {
+            bytes += Blit(
+                mFrameBuffer, sprites[draw.sprite],
+                static_cast<int>(draw.position.x * GRID_TILE_SIZE) + half,
+                static_cast<int>(draw.position.y * GRID_TILE_SIZE) + half
+            );
+        }
+    }
+
+    mTotals.draws += draws.Size();
+    mTotals.maxDraws = std::max<std::uint64_t>(mTotals.maxDraws, draws.Size());
+    mTotals.uniqueSprites += unique;
+    mTotals.bytes += bytes;
+    if (mStats) {
+        *mStats << mFrame << ',' << draws.Size() << ','
+                << unique << ',' << bytes << '\n';
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void NULLModule::SetTitle(const std::string& title)
+{
+    (void)title;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void NULLModule::LoadSpriteSheet(const std::string& path)
+{
+    (void)path;
+    mSheet.reset();
+    mLayer.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void NULLModule::LoadSpriteSheetPixels(const PixelView& sheet)
+{
+    mSheet = sheet;
+    mLayer.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::string NULLModule::GetName(void) const
+{
+    return ("NULL");
+}
+
+} // namespace Arc
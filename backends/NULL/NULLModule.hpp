@@ -0,0 +1,195 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Arcade/interfaces/IGraphicsModule.hpp"
+#include "Arcade/core/API.hpp"
+#include "Arcade/core/SpriteRegistry.hpp"
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Graphics module without any output device
+///
+/// It consumes the draw commands of every frame and measures them, so that
+/// the cost of the games can be benchmarked on a machine without display,
+/// terminal or GPU. It is configured from the environment:
+///
+/// - ARCADE_NULL_INPUT: scripted key presses, as frame:KEY pairs separated
+///   by commas, KEY being an EKeyboardKey name (A, UP, SPACE, 1...) or
+///   CLOSE to quit. Example: "60:SPACE,120:UP,600:CLOSE"
+/// - ARCADE_NULL_FRAMES: quit after this many frames
+/// - ARCADE_NULL_FRAMEBUFFER: if set to 1, the sprites are also blitted in
+///   an RGBA framebuffer, otherwise the commands are only counted
+/// - ARCADE_NULL_STATS: file receiving one CSV line per frame
+///
+/// A summary is printed on the error output when the module is destroyed.
+///
+///////////////////////////////////////////////////////////////////////////////
+class NULLModule : public IGraphicsModule
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief One event of the input script
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct ScriptedEvent
+    {
+        std::uint64_t frame;                    //<! Frame to push it on
+        API::Event event;                       //<! Pushed on CORE
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Totals over every frame
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Totals
+    {
+        std::uint64_t draws;                    //<! Draw commands
+        std::uint64_t maxDraws;                 //<! Most in one frame
+        std::uint64_t uniqueSprites;            //<! Summed per frame
+        std::uint64_t bytes;                    //<! Bytes read or written
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Member data
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<ScriptedEvent> mScript;         //<! Sorted by frame
+    std::size_t mNextEvent;                     //<! First event not pushed
+    std::uint64_t mFrame;                       //<! Rendered frames
+    std::uint64_t mFrameLimit;                  //<! 0 for no limit
+    Totals mTotals;                             //<! Since construction
+    std::vector<std::uint64_t> mSeen;           //<! Last frame of a sprite
+    std::optional<std::ofstream> mStats;        //<! Per frame CSV
+    bool mBlit;                                 //<! Fill mFrameBuffer
+    std::optional<PixelView> mSheet;            //<! Owned by the core
+    int mWidth;                                 //<! Framebuffer pixels
+    int mHeight;                                //<! Framebuffer pixels
+    std::vector<std::uint32_t> mFrameBuffer;    //<! RGBA, row-major
+    std::vector<std::uint32_t> mLayer;          //<! Prerendered tile layer
+    std::uint32_t mLayerVersion;                //<! Version of mLayer
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor, reads the configuration from the environment
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    NULLModule(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Destructor, prints the summary
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ~NULLModule();
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Parse the input script
+    ///
+    /// \param script The ARCADE_NULL_INPUT value
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void ParseScript(const std::string& script);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Size the framebuffer after the game grid
+    ///
+    /// \param width The grid width in cells
+    /// \param height The grid height in cells
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void ResizeFrameBuffer(int width, int height);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copy a sprite from the sheet, skipping transparent pixels
+    ///
+    /// \param target The destination, framebuffer sized
+    /// \param sprite The sprite
+    /// \param x The pixel column of the sprite center
+    /// \param y The pixel row of the sprite center
+    ///
+    /// \return The number of bytes written
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::uint64_t Blit(
+        std::vector<std::uint32_t>& target,
+        const Sprite& sprite,
+        int x,
+        int y
+    ) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Prerender the static tile layer when it changed
+    ///
+    /// \return The number of bytes written
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::uint64_t RefreshLayer(void);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Push the scripted events of this frame
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual void Update(void) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual void Clear(void) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Consume and measure the draw commands of the frame
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual void Render(void) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param title
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual void SetTitle(const std::string& title) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Forget the sheet, only the commands are counted
+    ///
+    /// \param path
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual void LoadSpriteSheet(const std::string& path) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Keep the view on the sheet for the framebuffer
+    ///
+    /// \param sheet The decoded sprite sheet
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual void LoadSpriteSheetPixels(const PixelView& sheet) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual std::string GetName(void) const override;
+};
+
+} // namespace Arc
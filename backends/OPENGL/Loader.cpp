@@ -2,8 +2,18 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "backends/OPENGL/OPENGLModule.hpp"
+#include "Arcade/core/ModuleDescriptor.hpp"
 #include <memory>
 
+///////////////////////////////////////////////////////////////////////////////
+// Module descriptor
+///////////////////////////////////////////////////////////////////////////////
+ARC_MODULE_DESCRIPTOR(
+    Arc::MODULE_GRAPHICS, "OPENGL",
+    "",
+    0
+);
+
 ///////////////////////////////////////////////////////////////////////////////
 // Extern C
 ///////////////////////////////////////////////////////////////////////////////
@@ -19,7 +29,7 @@ std::unique_ptr<Arc::IGraphicsModule> CreateArcadeObject(void)
 ///////////////////////////////////////////////////////////////////////////////
 std::string GetGraphicsName(void)
 {
-    return ("OPENGL");
+    return (ArcadeModuleDescriptor.name);
 }
 
 }
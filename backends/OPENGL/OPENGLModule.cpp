@@ -4,9 +4,9 @@
 #include "backends/OPENGL/OPENGLModule.hpp"
 #include "Arcade/core/API.hpp"
 #include "Arcade/errors/GraphicalException.hpp"
+#include <algorithm>
+#include <cstddef>
 #include <iostream>
-#define STB_IMAGE_IMPLEMENTATION
-#include "stb_image.h"
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Arc
@@ -15,10 +15,21 @@ namespace Arc
 {
 
 ///////////////////////////////////////////////////////////////////////////////
-OPENGLModule::OPENGLModule(void) : mInterpolationFactor(0.f)
-                                   ,mLastFrameTime(0),
+OPENGLModule::OPENGLModule(void) : mSpriteSheet(0),
                                    mWindowWidth(600),
-                                   mWindowHeight(600)
+                                   mWindowHeight(600),
+                                   mLayerFramebuffer(0),
+                                   mLayerTexture(0),
+                                   mLayerWidth(0),
+                                   mLayerHeight(0),
+                                   mLayerVersion(0),
+                                   mVBO(0),
+                                   mVertexCapacity(0),
+                                   mMappedVertices(nullptr),
+                                   mMappedCount(0),
+                                   mVertexCount(0),
+                                   mViewportLocation(-1),
+                                   mAtlasLocation(-1)
 {
     if (!glfwInit()) {
         throw GraphicalException("Failed to initialize GLFW");
@@ -54,6 +65,9 @@ OPENGLModule::~OPENGLModule(void)
 {
     glDeleteTextures(1, &mSpriteSheet);
     glDeleteVertexArrays(1, &mVAO);
+    if (mVBO) glDeleteBuffers(1, &mVBO);
+    if (mLayerFramebuffer) glDeleteFramebuffers(1, &mLayerFramebuffer);
+    if (mLayerTexture) glDeleteTextures(1, &mLayerTexture);
 
     if (mWindow) glfwDestroyWindow(mWindow);
     if (mShaderProgram) glDeleteProgram(mShaderProgram);
@@ -173,7 +187,7 @@ void OPENGLModule::Update(void)
             glViewport(0, 0, mWindowWidth, mWindowHeight);
 
         } else if (event->Is<API::Event::ChangeGame>())
-                    mSpritePositions.clear();
+                    mInterpolator.Clear();
     }
 
     glfwPollEvents();
@@ -229,9 +243,183 @@ void OPENGLModule::CompileShaders()
     glDeleteShader(vertexShader);
     glDeleteShader(fragmentShader);
 
+    // Uniforms do not move once linked, look them up a single time
+    mViewportLocation = glGetUniformLocation(mShaderProgram, "viewport");
+    mAtlasLocation = glGetUniformLocation(mShaderProgram, "textureAtlas");
+    glUseProgram(mShaderProgram);
+    glUniform1i(mAtlasLocation, 0);
+
     glGenVertexArrays(1, &mVAO);
     glBindVertexArray(mVAO);
 
+    // Every quad of a frame is streamed in this buffer
+    glGenBuffers(1, &mVBO);
+    glBindBuffer(GL_ARRAY_BUFFER, mVBO);
+    glVertexAttribPointer(
+        0, 2, GL_FLOAT, GL_FALSE, sizeof(QuadVertex),
+        reinterpret_cast<void*>(offsetof(QuadVertex, position))
+    );
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(
+        1, 2, GL_FLOAT, GL_FALSE, sizeof(QuadVertex),
+        reinterpret_cast<void*>(offsetof(QuadVertex, textureCoords))
+    );
+    glEnableVertexAttribArray(1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void OPENGLModule::BeginQuads(std::size_t count)
+{
+    std::size_t vertices = count * 6;
+
+    glBindBuffer(GL_ARRAY_BUFFER, mVBO);
+    if (vertices > mVertexCapacity) {
+        mVertexCapacity = std::max(vertices, mVertexCapacity * 2);
+        glBufferData(
+            GL_ARRAY_BUFFER, mVertexCapacity * sizeof(QuadVertex),
+            nullptr, GL_STREAM_DRAW
+        );
+    }
+
+    mVertexCount = 0;
+    mMappedCount = 0;
+    mMappedVertices = nullptr;
+    if (vertices == 0) {
+        return;
+    }
+
+    // Invalidating lets the driver hand out fresh storage instead of
+    // waiting for the previous draw to be done with the buffer
+    mMappedVertices = static_cast<QuadVertex*>(glMapBufferRange(
+        GL_ARRAY_BUFFER, 0, vertices * sizeof(QuadVertex),
+        GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT
+    ));
+    if (mMappedVertices) {
+        mMappedCount = vertices;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void OPENGLModule::PushQuad(
+    const glm::vec2& texTopLeft,
+    const glm::vec2& texBottomRight,
+    const glm::vec2& position,
+    const glm::vec2& size
+)
+{
+    if (mVertexCount + 6 > mMappedCount) {
+        return;
+    }
+
+    glm::vec2 bottomRight = position + size;
+    QuadVertex* vertex = mMappedVertices + mVertexCount;
+
+    // Top Left, Bottom Left, Top Right, Top Right, Bottom Left, Bottom Right
+    vertex[0] = {position, texTopLeft};
+    vertex[1] = {{position.x, bottomRight.y},
+        {texTopLeft.x, texBottomRight.y}};
+    vertex[2] = {{bottomRight.x, position.y},
+        {texBottomRight.x, texTopLeft.y}};
+    vertex[3] = vertex[2];
+    vertex[4] = vertex[1];
+    vertex[5] = {bottomRight, texBottomRight};
+    mVertexCount += 6;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void OPENGLModule::EndQuads(const glm::vec2& viewport)
+{
+    if (!mMappedVertices) {
+        return;
+    }
+
+    glUnmapBuffer(GL_ARRAY_BUFFER);
+    mMappedVertices = nullptr;
+    mMappedCount = 0;
+
+    glUniform2f(mViewportLocation, viewport.x, viewport.y);
+    glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(mVertexCount));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void OPENGLModule::RenderLayer(void)
+{
+    const TileLayer& layer = API::GetLayer();
+
+    if (layer.IsEmpty() || !mSpriteSheet) {
+        return;
+    }
+
+    int width = layer.GetWidth() * GRID_TILE_SIZE;
+    int height = layer.GetHeight() * GRID_TILE_SIZE;
+
+    if (!mLayerFramebuffer) {
+        glGenFramebuffers(1, &mLayerFramebuffer);
+        glGenTextures(1, &mLayerTexture);
+    }
+
+    if (width != mLayerWidth || height != mLayerHeight) {
+        glBindTexture(GL_TEXTURE_2D, mLayerTexture);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexImage2D(
+            GL_TEXTURE_2D, 0, GL_RGBA,
+            width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr
+        );
+        glBindFramebuffer(GL_FRAMEBUFFER, mLayerFramebuffer);
+        glFramebufferTexture2D(
+            GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+            GL_TEXTURE_2D, mLayerTexture, 0
+        );
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        mLayerWidth = width;
+        mLayerHeight = height;
+        mLayerVersion = 0;
+    }
+
+    glm::vec2 layerSize = {width, height};
+
+    if (layer.GetVersion() != mLayerVersion) {
+        Span<const Sprite> sprites = API::GetSprites();
+
+        glBindFramebuffer(GL_FRAMEBUFFER, mLayerFramebuffer);
+        glViewport(0, 0, width, height);
+        glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        glBindTexture(GL_TEXTURE_2D, mSpriteSheet);
+
+        BeginQuads(layer.GetTiles().Size());
+        for (int y = 0; y < layer.GetHeight(); y++) {
+            for (int x = 0; x < layer.GetWidth(); x++) {
+                const Sprite& sprite = sprites[layer.Get(x, y)];
+                glm::vec2 atlas = {sprite.atlas.x * GRID_TILE_SIZE,
+                    sprite.atlas.y * GRID_TILE_SIZE};
+                glm::vec2 size = {sprite.size.x, sprite.size.y};
+                glm::vec2 position = {
+                    x * GRID_TILE_SIZE - (size.x - GRID_TILE_SIZE) / 2.0f,
+                    y * GRID_TILE_SIZE - (size.y - GRID_TILE_SIZE) / 2.0f
+                };
+
+                PushQuad(atlas, atlas + size, position, size);
+            }
+        }
+        EndQuads(layerSize);
+
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glViewport(0, 0, mWindowWidth, mWindowHeight);
+        mLayerVersion = layer.GetVersion();
+    }
+
+    // the framebuffer rows are stored bottom-up, so flip the texels
+    const Vec2i& origin = layer.GetOrigin();
+    glm::vec2 position = {origin.x * GRID_TILE_SIZE * mRatio,
+        origin.y * GRID_TILE_SIZE * mRatio};
+
+    glBindTexture(GL_TEXTURE_2D, mLayerTexture);
+    BeginQuads(1);
+    PushQuad({0.0f, layerSize.y}, {layerSize.x, 0.0f},
+        position, layerSize * mRatio);
+    EndQuads({mWindowWidth, mWindowHeight});
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -245,121 +433,57 @@ void OPENGLModule::Render()
 
     glViewport(0, 0, mWindowWidth, mWindowHeight);
 
-    while (!API::IsDrawQueueEmpty()) {
-        auto draw = API::PopDraw();
-        auto [asset, pos, color] = draw;
-        int entityId = asset.id;
-
-        glm::vec2 targetPos = {
-            pos.x * GRID_TILE_SIZE - (asset.size.x - GRID_TILE_SIZE) / 2.0f,
-            pos.y * GRID_TILE_SIZE - (asset.size.y - GRID_TILE_SIZE) / 2.0f
-        };
-
-        if (
-            entityId == -1 ||
-            mSpritePositions.find(entityId) == mSpritePositions.end()
-        ) {
-            mSpritePositions[entityId] = {targetPos, targetPos, 1.0f};
-        } else {
-            float length = std::sqrt(
-                std::pow(targetPos.x - mSpritePositions[entityId].current.x, 2)
-                    +
-                std::pow(targetPos.y - mSpritePositions[entityId].current.y, 2)
-            );
+    mInterpolator.Advance();
+    RenderLayer();
 
-            if (length > 15.f) {
-                mSpritePositions[entityId].target = targetPos;
-                mSpritePositions[entityId].current = targetPos;
-                mSpritePositions[entityId].factor = 1.0f;
-            } else if (mSpritePositions[entityId].target.x != targetPos.x ||
-                mSpritePositions[entityId].target.y != targetPos.y) {
-                mSpritePositions[entityId].target = targetPos;
-                mSpritePositions[entityId].factor = 0.0f;
-            }
-        }
-        glm::vec2 currentPos = mSpritePositions[entityId].current;
+    Span<const Sprite> sprites = API::GetSprites();
+    Span<const DrawCommand> commands = API::GetDrawCommands();
 
-        glm::vec2 interpolatedPos = {
-            currentPos.x + (targetPos.x - currentPos.x)
-                * mSpritePositions[entityId].factor,
-            currentPos.y + (targetPos.y - currentPos.y)
-                * mSpritePositions[entityId].factor
-        };
+    glBindTexture(GL_TEXTURE_2D, mSpriteSheet);
+    BeginQuads(commands.Size());
+    for (const DrawCommand& draw : commands) {
+        const Sprite& sprite = sprites[draw.sprite];
+        Vec2f position = mInterpolator.Track(draw.id, Vec2f(
+            draw.position.x * GRID_TILE_SIZE -
+                (sprite.size.x - GRID_TILE_SIZE) / 2.0f,
+            draw.position.y * GRID_TILE_SIZE -
+                (sprite.size.y - GRID_TILE_SIZE) / 2.0f
+        ));
+        glm::vec2 interpolatedPos = {position.x, position.y};
 
         // set origin point to top-left corner:
-        glm::vec2 originPoint = {asset.position.x * GRID_TILE_SIZE,
-                asset.position.y * GRID_TILE_SIZE};
-
-        glm::vec2 textureCoords[6] = {
-                // vec2 (left, top),
-            glm::vec2 ({originPoint}),
-                // vec2 (left, bottom),
-            glm::vec2 (originPoint.x, originPoint.y + asset.size.y),
-                // vec2 (right, top),
-            glm::vec2 (originPoint.x + asset.size.x, originPoint.y),
-                // vec2 (right, top),
-            glm::vec2 (originPoint.x + asset.size.x, originPoint.y),
-                // vec2 (left, bottom),
-            glm::vec2 (originPoint.x, originPoint.y + asset.size.y),
-                // vec2 (right, bottom),
-            glm::vec2 (originPoint.x + asset.size.x,
-                originPoint.y + asset.size.y)
-        };
-
-        float ndcX = 2.0f / mWindowWidth;
-        float ndcY = 2.0f / mWindowHeight;
-
-        float scaledX = interpolatedPos.x * mRatio;
-        float scaledY = interpolatedPos.y * mRatio;
-        float scaledWidth = asset.size.x * mRatio;
-        float scaledHeight = asset.size.y * mRatio;
-
-        float left = (scaledX * ndcX) - 1.0f;
-        float top = 1.0f - (scaledY * ndcY);
-        float right = ((scaledX + scaledWidth) * ndcX) - 1.0f;
-        float bottom = 1.0f - ((scaledY + scaledHeight) * ndcY);
-
-        glm::vec2 vertices[6] = {
-            glm::vec2(left, top),  // Top Left
-            glm::vec2(left, bottom),  // Bottom Left
-            glm::vec2(right, top),  // Top Right
-            glm::vec2(right, top),  // Top Right (duplicate)
-            glm::vec2(left, bottom),  // Bottom Left (duplicate)
-            glm::vec2(right, bottom) // Bottom Right
-        };
-
-        GLuint textureCoordsLocation = glGetUniformLocation(
-            mShaderProgram, "textureCoords"
-        );
-
-        glUniform2fv(
-            textureCoordsLocation, 6, glm::value_ptr(textureCoords[0])
-        );
+        glm::vec2 originPoint = {sprite.atlas.x * GRID_TILE_SIZE,
+                sprite.atlas.y * GRID_TILE_SIZE};
+        glm::vec2 size = {sprite.size.x, sprite.size.y};
 
-        GLuint vertexPositionsLocation = glGetUniformLocation(
-            mShaderProgram, "vertices"
+        PushQuad(
+            originPoint, originPoint + size,
+            interpolatedPos * mRatio, size * mRatio
         );
-        glUniform2fv(vertexPositionsLocation, 6, glm::value_ptr(vertices[0]));
-
-        glDrawArrays(GL_TRIANGLES, 0, 6);
     }
+    EndQuads({mWindowWidth, mWindowHeight});
 
     glBindVertexArray(0);
 
     glfwSwapBuffers(mWindow);
 }
 
-
 ///////////////////////////////////////////////////////////////////////////////
 void OPENGLModule::LoadSpriteSheet(const std::string& path)
 {
-    int channels;
-    unsigned char* data = stbi_load(
-        path.c_str(), &mAtlasWidth, &mAtlasHeight, &channels, 4
-    );
-    if (!data) return;
+    // The core decodes the sheets, it only calls this when it could not
+    (void)path;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void OPENGLModule::LoadSpriteSheetPixels(const PixelView& sheet)
+{
+    mAtlasWidth = sheet.width;
+    mAtlasHeight = sheet.height;
+    mLayerVersion = 0;
 
-    glGenTextures(1, &mSpriteSheet);
+    // glTexImage2D reallocates the storage, the texture name is kept
+    if (!mSpriteSheet) glGenTextures(1, &mSpriteSheet);
     glActiveTexture(GL_TEXTURE0);
     glBindTexture(GL_TEXTURE_2D, mSpriteSheet);
 
@@ -371,9 +495,8 @@ void OPENGLModule::LoadSpriteSheet(const std::string& path)
 
     glTexImage2D(
         GL_TEXTURE_2D, 0, GL_RGBA,
-        mAtlasWidth, mAtlasHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, data
+        mAtlasWidth, mAtlasHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, sheet.pixels
     );
-    stbi_image_free(data);
 }
 
 
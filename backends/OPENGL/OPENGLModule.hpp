@@ -2,15 +2,16 @@
 // Header guard
 ///////////////////////////////////////////////////////////////////////////////
 #pragma once
-// #define STB_IMAGE_IMPLEMENTATION
 
 ///////////////////////////////////////////////////////////////////////////////
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "Arcade/interfaces/IGraphicsModule.hpp"
 #include "Arcade/enums/Inputs.hpp"
+#include "Arcade/shared/Interpolator.hpp"
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
+#include <cstdint>
 #include <unordered_map>
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
@@ -34,11 +35,14 @@ class OPENGLModule : public IGraphicsModule
 
 
 private:
-struct EntityInterpolation
+///////////////////////////////////////////////////////////////////////////////
+/// \brief one vertex of the streamed quad buffer
+///
+///////////////////////////////////////////////////////////////////////////////
+struct QuadVertex
 {
-    glm::vec2 current;
-    glm::vec2 target;
-    float factor;
+    glm::vec2 position;                         //<! In viewport pixels
+    glm::vec2 textureCoords;                    //<! In texels
 };
 
 private:
@@ -48,11 +52,7 @@ private:
     GLFWwindow* mWindow;                        //<! The window container
     GLuint mSpriteSheet;                        //<! The texture
     float mRatio;                               //<! The scaling ratio
-    std::unordered_map<
-        int, EntityInterpolation
-    > mSpritePositions;
-    float mInterpolationFactor;                 //<!
-    GLuint mLastFrameTime;                      //<!
+    Interpolator mInterpolator;                 //<! Smoothed entities
     GLuint mVAO;                                //<! The Vertex Array Object
     GLuint mShaderProgram;                      //<! The ShaderProgram pointer
     int mAtlasHeight;                           //<! The Height of the Atlas
@@ -61,6 +61,18 @@ private:
     int mWindowHeight;                          //<! The Width of the window
     int mgridWidth;                             //<! The Height of the grid
     int mgridHeight;                            //<! The Height of the grid
+    GLuint mLayerFramebuffer;                   //<! The tile layer target
+    GLuint mLayerTexture;                       //<! The tile layer pixels
+    int mLayerWidth;                            //<! The Width of the layer
+    int mLayerHeight;                           //<! The Height of the layer
+    std::uint32_t mLayerVersion;                //<! The version of the layer
+    GLuint mVBO;                                //<! The streamed quad buffer
+    std::size_t mVertexCapacity;                //<! The vertices mVBO holds
+    QuadVertex* mMappedVertices;                //<! The mapped mVBO range
+    std::size_t mMappedCount;                   //<! The vertices mapped
+    std::size_t mVertexCount;                   //<! The vertices written
+    GLint mViewportLocation;                    //<! The viewport uniform
+    GLint mAtlasLocation;                       //<! The texture uniform
 
 public:
     ///////////////////////////////////////////////////////////////////////////
@@ -81,14 +93,15 @@ private:
 const char *vertexShaderSource = R"(
     #version 430 core
 
+    layout (location = 0) in vec2 position;
+    layout (location = 1) in vec2 textureCoords;
     layout (location = 0) out vec2 textureCoordsOut;
-    uniform mat4 projection;
-    uniform vec2 textureCoords[6];
-    uniform vec2 vertices[6];
+    uniform vec2 viewport;
 
     void main() {
-        gl_Position = vec4(vertices[gl_VertexID], 0.0, 1.0);
-        textureCoordsOut = textureCoords[gl_VertexID];
+        vec2 ndc = position / viewport * 2.0 - 1.0;
+        gl_Position = vec4(ndc.x, -ndc.y, 0.0, 1.0);
+        textureCoordsOut = textureCoords;
     }
 )";
 
@@ -113,6 +126,47 @@ const char* fragmentShaderSource = R"(
     ///////////////////////////////////////////////////////////////////////////
     void CompileShaders();
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief maps the quad buffer for a batch of quads, growing it when the
+    ///     batch does not fit
+    ///
+    /// \param count The number of quads of the batch
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void BeginQuads(std::size_t count);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief writes one textured quad in the mapped quad buffer
+    ///
+    /// \param texTopLeft The top left texel of the quad
+    /// \param texBottomRight The bottom right texel of the quad
+    /// \param position The top left corner in viewport pixels
+    /// \param size The size in viewport pixels
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void PushQuad(
+        const glm::vec2& texTopLeft,
+        const glm::vec2& texBottomRight,
+        const glm::vec2& position,
+        const glm::vec2& size
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief unmaps the quad buffer and draws the batch in one call with
+    ///     the bound texture
+    ///
+    /// \param viewport The size of the viewport in pixels
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void EndQuads(const glm::vec2& viewport);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief draws the static tile layer, prerendering it in a framebuffer
+    ///     only when the layer changed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void RenderLayer(void);
+
 private:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief whenever a key is pressed, eventpoll automatically will call
@@ -208,6 +262,14 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     virtual void LoadSpriteSheet(const std::string& path) override;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Load sprite sheet from decoded pixels
+    ///
+    /// \param sheet The decoded sprite sheet
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual void LoadSpriteSheetPixels(const PixelView& sheet) override;
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Get the name of the library
     ///
@@ -16,9 +16,9 @@ SDL2Module::SDL2Module(void)
     : mWindow(nullptr)
     , mRenderer(nullptr)
     , mSpriteSheet(nullptr)
+    , mLayer(nullptr)
+    , mLayerVersion(0)
     , mRatio(4.f)
-    , mInterpolationFactor(0.f)
-    , mLastFrameTime(0)
 {
     if (SDL_Init(SDL_INIT_VIDEO) < 0) {
         std::cerr << "Cannot init SDL2" << std::endl;
@@ -47,13 +47,16 @@ SDL2Module::SDL2Module(void)
 ///////////////////////////////////////////////////////////////////////////////
 SDL2Module::~SDL2Module(void)
 {
-    mSpritePositions.clear();
-
     if (mSpriteSheet) {
         SDL_DestroyTexture(mSpriteSheet);
         mSpriteSheet = nullptr;
     }
 
+    if (mLayer) {
+        SDL_DestroyTexture(mLayer);
+        mLayer = nullptr;
+    }
+
     if (mRenderer) {
         SDL_DestroyRenderer(mRenderer);
         mRenderer = nullptr;
@@ -156,7 +159,7 @@ void SDL2Module::Update(void)
             );
             SDL_RenderSetScale(mRenderer, mRatio, mRatio);
         } else if (event->Is<API::Event::ChangeGame>()) {
-            mSpritePositions.clear();
+            mInterpolator.Clear();
         }
     }
 
@@ -165,6 +168,9 @@ void SDL2Module::Update(void)
         if (event.type == SDL_QUIT) {
             API::PushEvent(API::Event::Channel::CORE, API::Event::Closed());
         }
+        if (event.type == SDL_RENDER_TARGETS_RESET) {
+            mLayerVersion = 0;
+        }
         if (event.type == SDL_KEYDOWN){
             SDL_Keycode key = event.key.keysym.sym;
             API::PushEvent(
@@ -190,74 +196,113 @@ void SDL2Module::Clear(void)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void SDL2Module::Render(void)
+void SDL2Module::RenderLayer(void)
 {
-    Uint32 currentTime = SDL_GetTicks();
-    Uint32 deltaTime = mLastFrameTime ? (currentTime - mLastFrameTime) : 0;
-    mLastFrameTime = currentTime;
-
-    float deltaSeconds = deltaTime / 1000.0f;
-    float speed = 10.0f;
-
-    for (auto& [id, interp] : mSpritePositions) {
-        interp.factor += deltaSeconds * speed;
-        if (interp.factor > 1.0f) {
-            interp.factor = 1.0f;
-            interp.current = interp.target;
+    const TileLayer& layer = API::GetLayer();
+
+    if (layer.IsEmpty() || !mSpriteSheet) {
+        return;
+    }
+
+    int width = layer.GetWidth() * GRID_TILE_SIZE;
+    int height = layer.GetHeight() * GRID_TILE_SIZE;
+    int textureWidth = 0;
+    int textureHeight = 0;
+
+    if (mLayer) {
+        SDL_QueryTexture(mLayer, NULL, NULL, &textureWidth, &textureHeight);
+        if (textureWidth != width || textureHeight != height) {
+            SDL_DestroyTexture(mLayer);
+            mLayer = nullptr;
         }
     }
 
-    while (!API::IsDrawQueueEmpty()) {
-        auto draw = API::PopDraw();
-        auto [asset, pos, color] = draw;
-        int entityId = asset.id;
-
-        SDL_FPoint targetPos = {
-            pos.x * GRID_TILE_SIZE - (asset.size.x - GRID_TILE_SIZE) / 2.0f,
-            pos.y * GRID_TILE_SIZE - (asset.size.y - GRID_TILE_SIZE) / 2.0f
-        };
-
-        if (
-            entityId == -1 ||
-            mSpritePositions.find(entityId) == mSpritePositions.end()
-        ) {
-            mSpritePositions[entityId] = {targetPos, targetPos, 1.0f};
-        } else {
-            float length = std::sqrt(
-                std::pow(targetPos.x - mSpritePositions[entityId].current.x, 2) +
-                std::pow(targetPos.y - mSpritePositions[entityId].current.y, 2)
+    if (!mLayer || layer.GetVersion() != mLayerVersion) {
+        if (!mLayer) {
+            mLayer = SDL_CreateTexture(
+                mRenderer, SDL_PIXELFORMAT_RGBA8888,
+                SDL_TEXTUREACCESS_TARGET, width, height
             );
-
-            if (length > 15.f) {
-                mSpritePositions[entityId].target = targetPos;
-                mSpritePositions[entityId].current = targetPos;
-                mSpritePositions[entityId].factor = 1.0f;
-            } else if (mSpritePositions[entityId].target.x != targetPos.x ||
-                mSpritePositions[entityId].target.y != targetPos.y) {
-                mSpritePositions[entityId].target = targetPos;
-                mSpritePositions[entityId].factor = 0.0f;
+        }
+        if (!mLayer) {
+            return;
+        }
+        SDL_SetTextureBlendMode(mLayer, SDL_BLENDMODE_BLEND);
+
+        Uint8 r, g, b, a;
+        SDL_GetRenderDrawColor(mRenderer, &r, &g, &b, &a);
+        SDL_SetRenderTarget(mRenderer, mLayer);
+        SDL_SetRenderDrawColor(mRenderer, 0, 0, 0, 0);
+        SDL_RenderClear(mRenderer);
+
+        Span<const Sprite> sprites = API::GetSprites();
+
+        for (int y = 0; y < layer.GetHeight(); y++) {
+            for (int x = 0; x < layer.GetWidth(); x++) {
+                const Sprite& sprite = sprites[layer.Get(x, y)];
+
+                SDL_Rect srcRect;
+                srcRect.x = sprite.atlas.x * GRID_TILE_SIZE;
+                srcRect.y = sprite.atlas.y * GRID_TILE_SIZE;
+                srcRect.w = sprite.size.x;
+                srcRect.h = sprite.size.y;
+
+                SDL_Rect destRect;
+                destRect.x = x * GRID_TILE_SIZE -
+                    (sprite.size.x - GRID_TILE_SIZE) / 2;
+                destRect.y = y * GRID_TILE_SIZE -
+                    (sprite.size.y - GRID_TILE_SIZE) / 2;
+                destRect.w = sprite.size.x;
+                destRect.h = sprite.size.y;
+
+                SDL_RenderCopy(mRenderer, mSpriteSheet, &srcRect, &destRect);
             }
         }
 
-        SDL_FPoint currentPos = mSpritePositions[entityId].current;
-        SDL_FPoint interpolatedPos = {
-            currentPos.x + (targetPos.x - currentPos.x) *
-                mSpritePositions[entityId].factor,
-            currentPos.y + (targetPos.y - currentPos.y) *
-                mSpritePositions[entityId].factor
-        };
+        SDL_SetRenderTarget(mRenderer, NULL);
+        SDL_SetRenderDrawColor(mRenderer, r, g, b, a);
+        mLayerVersion = layer.GetVersion();
+    }
+
+    const Vec2i& origin = layer.GetOrigin();
+    SDL_Rect destRect;
+    destRect.x = origin.x * GRID_TILE_SIZE;
+    destRect.y = origin.y * GRID_TILE_SIZE;
+    destRect.w = width;
+    destRect.h = height;
+
+    SDL_RenderCopy(mRenderer, mLayer, NULL, &destRect);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void SDL2Module::Render(void)
+{
+    mInterpolator.Advance();
+
+    RenderLayer();
+
+    Span<const Sprite> sprites = API::GetSprites();
+
+    for (const DrawCommand& draw : API::GetDrawCommands()) {
+        const Sprite& sprite = sprites[draw.sprite];
+        Vec2f interpolatedPos = mInterpolator.Track(draw.id, Vec2f(
+            draw.position.x * GRID_TILE_SIZE -
+                (sprite.size.x - GRID_TILE_SIZE) / 2.0f,
+            draw.position.y * GRID_TILE_SIZE -
+                (sprite.size.y - GRID_TILE_SIZE) / 2.0f
+        ));
 
         SDL_Rect srcRect;
-        srcRect.x = asset.position.x * GRID_TILE_SIZE;
-        srcRect.y = asset.position.y * GRID_TILE_SIZE;
-        srcRect.w = asset.size.x;
-        srcRect.h = asset.size.y;
+        srcRect.x = sprite.atlas.x * GRID_TILE_SIZE;
+        srcRect.y = sprite.atlas.y * GRID_TILE_SIZE;
+        srcRect.w = sprite.size.x;
+        srcRect.h = sprite.size.y;
 
         SDL_Rect destRect;
         destRect.x = static_cast<int>(interpolatedPos.x);
         destRect.y = static_cast<int>(interpolatedPos.y);
-        destRect.w = asset.size.x;
-        destRect.h = asset.size.y;
+        destRect.w = sprite.size.x;
+        destRect.h = sprite.size.y;
 
         SDL_RenderCopy(mRenderer, mSpriteSheet, &srcRect, &destRect);
     }
@@ -280,6 +325,7 @@ void SDL2Module::LoadSpriteSheet(const std::string& path)
         SDL_DestroyTexture(mSpriteSheet);
         mSpriteSheet = nullptr;
     }
+    mLayerVersion = 0;
 
     SDL_Surface* surface = IMG_Load(path.c_str());
     if (!surface) return;
@@ -292,6 +338,36 @@ void SDL2Module::LoadSpriteSheet(const std::string& path)
     mSpriteSheet = texture;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void SDL2Module::LoadSpriteSheetPixels(const PixelView& sheet)
+{
+    if (!mRenderer) return;
+
+    int width = 0;
+    int height = 0;
+
+    mLayerVersion = 0;
+    if (mSpriteSheet) {
+        SDL_QueryTexture(mSpriteSheet, nullptr, nullptr, &width, &height);
+    }
+    if (
+        !mSpriteSheet ||
+        width != static_cast<int>(sheet.width) ||
+        height != static_cast<int>(sheet.height)
+    ) {
+        if (mSpriteSheet) {
+            SDL_DestroyTexture(mSpriteSheet);
+        }
+        mSpriteSheet = SDL_CreateTexture(
+            mRenderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC,
+            sheet.width, sheet.height
+        );
+        if (!mSpriteSheet) return;
+        SDL_SetTextureBlendMode(mSpriteSheet, SDL_BLENDMODE_BLEND);
+    }
+    SDL_UpdateTexture(mSpriteSheet, nullptr, sheet.pixels, sheet.width * 4);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 std::string SDL2Module::GetName(void) const
 {
@@ -8,9 +8,9 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "Arcade/interfaces/IGraphicsModule.hpp"
 #include "Arcade/enums/Inputs.hpp"
+#include "Arcade/shared/Interpolator.hpp"
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_image.h>
-#include <unordered_map>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Arc
@@ -23,18 +23,6 @@ namespace Arc
 ///////////////////////////////////////////////////////////////////////////////
 class SDL2Module : public IGraphicsModule
 {
-private:
-    ///////////////////////////////////////////////////////////////////////////
-    /// \brief
-    ///
-    ///////////////////////////////////////////////////////////////////////////
-    struct EntityInterpolation
-    {
-        SDL_FPoint current;
-        SDL_FPoint target;
-        float factor;
-    };
-
 private:
     ///////////////////////////////////////////////////////////////////////////
     // Data members
@@ -42,12 +30,10 @@ private:
     SDL_Window* mWindow;                        //<! The window container
     SDL_Renderer* mRenderer;                    //<! The rendering
     SDL_Texture* mSpriteSheet;                  //<! The texture
+    SDL_Texture* mLayer;                        //<! Prerendered tile layer
+    Uint32 mLayerVersion;                       //<! Version of mLayer
     float mRatio;                               //<! The scaling ratio
-    std::unordered_map<
-        int, EntityInterpolation
-    > mSpritePositions;                         //<!
-    float mInterpolationFactor;                 //<!
-    Uint32 mLastFrameTime;                      //<!
+    Interpolator mInterpolator;                 //<! Smoothed entities
 
 public:
     ///////////////////////////////////////////////////////////////////////////
@@ -83,6 +69,13 @@ private:
     ///////////////////////////////////////////////////////////////////////////
     EMouseButton GetMousePress(Uint8 click);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copy the static tile layer, prerendering it in a target
+    /// texture only when the layer changed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void RenderLayer(void);
+
 public:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Update the graphics module
@@ -118,6 +111,14 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     virtual void LoadSpriteSheet(const std::string& path) override;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Load sprite sheet from decoded pixels
+    ///
+    /// \param sheet The decoded sprite sheet
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual void LoadSpriteSheetPixels(const PixelView& sheet) override;
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Get the name of the library
     ///
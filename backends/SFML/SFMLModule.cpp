@@ -13,8 +13,9 @@ namespace Arc
 
 ///////////////////////////////////////////////////////////////////////////////
 SFMLModule::SFMLModule(void)
-    : mRatio(4.f)
-    , mInterpolationFactor(0.f)
+    : mLayerVersion(0)
+    , mRatio(4.f)
+    , mInterpolator(10.f, 16.f)
 {
     mWindow = std::make_unique<sf::RenderWindow>(
         sf::VideoMode(600, 600), "Arcade - SFML"
@@ -124,7 +125,7 @@ void SFMLModule::Update(void)
                 }
             ));
         } else if (event->Is<API::Event::ChangeGame>()) {
-            mSpritePositions.clear();
+            mInterpolator.Clear();
         }
     }
 
@@ -156,69 +157,86 @@ void SFMLModule::Clear(void)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void SFMLModule::Render(void)
+void SFMLModule::RenderLayer(void)
 {
-    float offset = static_cast<float>(GRID_TILE_SIZE) / 2.f;
+    const TileLayer& layer = API::GetLayer();
 
-    float deltaTime = mInterpolationClock.restart().asSeconds();
-    float speed = 10.0f;
+    if (layer.IsEmpty() || !mSpriteSheet) {
+        return;
+    }
 
-    for (auto& [id, interp] : mSpritePositions) {
-        interp.factor += deltaTime * speed;
-        if (interp.factor > 1.0f) {
-            interp.factor = 1.0f;
-            interp.current = interp.target;
-        }
+    unsigned int width = layer.GetWidth() * GRID_TILE_SIZE;
+    unsigned int height = layer.GetHeight() * GRID_TILE_SIZE;
+
+    if (mLayer && mLayer->getSize() != sf::Vector2u(width, height)) {
+        mLayer.reset();
     }
 
-    while (mSpriteSheet && !API::IsDrawQueueEmpty()) {
-        auto draw = API::PopDraw();
-        auto [asset, pos, color] = draw;
-        int entityId = asset.id;
-
-        sf::Vector2f targetPos(
-            pos.x * GRID_TILE_SIZE + offset,
-            pos.y * GRID_TILE_SIZE + offset
-        );
-
-        if (
-            entityId == -1 ||
-            mSpritePositions.find(entityId) == mSpritePositions.end()
-        ) {
-            mSpritePositions[entityId] = {targetPos, targetPos, 1.0f};
-        } else {
-            float length = std::sqrt(
-                std::pow(targetPos.x - mSpritePositions[entityId].current.x, 2) +
-                std::pow(targetPos.y - mSpritePositions[entityId].current.y, 2)
-            );
+    if (!mLayer || layer.GetVersion() != mLayerVersion) {
+        if (!mLayer) {
+            mLayer = std::make_unique<sf::RenderTexture>();
+            if (!mLayer->create(width, height)) {
+                mLayer.reset();
+                return;
+            }
+        }
 
-            if (length > 16.f) {
-                mSpritePositions[entityId].target = targetPos;
-                mSpritePositions[entityId].current = targetPos;
-                mSpritePositions[entityId].factor = 1.0f;
-            } else if (mSpritePositions[entityId].target != targetPos) {
-                mSpritePositions[entityId].target = targetPos;
-                mSpritePositions[entityId].factor = 0.0f;
+        float offset = static_cast<float>(GRID_TILE_SIZE) / 2.f;
+        Span<const Sprite> sprites = API::GetSprites();
+
+        mBatch.Clear();
+        for (int y = 0; y < layer.GetHeight(); y++) {
+            for (int x = 0; x < layer.GetWidth(); x++) {
+                sf::Vector2f center(
+                    x * GRID_TILE_SIZE + offset,
+                    y * GRID_TILE_SIZE + offset
+                );
+
+                mBatch.Add(sprites[layer.Get(x, y)], center, {255, 255, 255});
             }
         }
+        mLayer->clear(sf::Color::Transparent);
+        mBatch.Draw(*mLayer, *mSpriteSheet);
+        mLayer->display();
+        mLayerVersion = layer.GetVersion();
+    }
 
-        sf::Vector2f currentPos = mSpritePositions[entityId].current;
-        sf::Vector2f interpolatedPos = currentPos +
-            (targetPos - currentPos) * mSpritePositions[entityId].factor;
-
-        sf::Sprite sprite;
-        sprite.setTexture(*mSpriteSheet);
-        sprite.setTextureRect(sf::IntRect(
-            asset.position.x * GRID_TILE_SIZE,
-            asset.position.y * GRID_TILE_SIZE,
-            asset.size.x,
-            asset.size.y
+    const Vec2i& origin = layer.GetOrigin();
+    sf::Sprite drawable(mLayer->getTexture());
+
+    drawable.setPosition(
+        static_cast<float>(origin.x * GRID_TILE_SIZE),
+        static_cast<float>(origin.y * GRID_TILE_SIZE)
+    );
+    mWindow->draw(drawable);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void SFMLModule::Render(void)
+{
+    float offset = static_cast<float>(GRID_TILE_SIZE) / 2.f;
+
+    mInterpolator.Advance();
+    RenderLayer();
+
+    if (!mSpriteSheet) {
+        mWindow->display();
+        return;
+    }
+
+    Span<const Sprite> sprites = API::GetSprites();
+
+    mBatch.Clear();
+    for (const DrawCommand& draw : API::GetDrawCommands()) {
+        const Sprite& sprite = sprites[draw.sprite];
+        Vec2f position = mInterpolator.Track(draw.id, Vec2f(
+            draw.position.x * GRID_TILE_SIZE + offset,
+            draw.position.y * GRID_TILE_SIZE + offset
         ));
-        sprite.setOrigin({asset.size.x / 2.f, asset.size.y / 2.f});
-        sprite.setPosition(interpolatedPos);
-        sprite.setColor(sf::Color(color.r, color.g, color.b));
-        mWindow->draw(sprite);
+
+        mBatch.Add(sprite, {position.x, position.y}, draw.color);
     }
+    mBatch.Draw(*mWindow, *mSpriteSheet);
     mWindow->display();
 }
 
@@ -238,6 +256,24 @@ void SFMLModule::LoadSpriteSheet(const std::string& path)
         return;
     }
     mSpriteSheet.reset(texture);
+    mLayerVersion = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void SFMLModule::LoadSpriteSheetPixels(const PixelView& sheet)
+{
+    sf::Vector2u size(sheet.width, sheet.height);
+
+    if (!mSpriteSheet || mSpriteSheet->getSize() != size) {
+        std::unique_ptr<sf::Texture> texture(new sf::Texture());
+
+        if (!texture->create(size.x, size.y)) {
+            return;
+        }
+        mSpriteSheet = std::move(texture);
+    }
+    mSpriteSheet->update(sheet.pixels);
+    mLayerVersion = 0;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8,10 +8,12 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "Arcade/interfaces/IGraphicsModule.hpp"
 #include "Arcade/enums/Inputs.hpp"
+#include "Arcade/shared/Interpolator.hpp"
+#include "backends/SFML/SpriteBatch.hpp"
 #include <SFML/Graphics.hpp>
 #include <SFML/Window.hpp>
+#include <cstdint>
 #include <memory>
-#include <unordered_map>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Arc
@@ -25,30 +27,17 @@ namespace Arc
 ///////////////////////////////////////////////////////////////////////////////
 class SFMLModule : public IGraphicsModule
 {
-private:
-    ///////////////////////////////////////////////////////////////////////////
-    /// \brief
-    ///
-    ///////////////////////////////////////////////////////////////////////////
-    struct EntityInterpolation
-    {
-        sf::Vector2f current;
-        sf::Vector2f target;
-        float factor;
-    };
-
 private:
     ///////////////////////////////////////////////////////////////////////////
     // Data members
     ///////////////////////////////////////////////////////////////////////////
     std::unique_ptr<sf::RenderWindow> mWindow;  //<! The window
     std::unique_ptr<sf::Texture> mSpriteSheet;  //<! The texture
+    std::unique_ptr<sf::RenderTexture> mLayer;  //<! Prerendered tile layer
+    std::uint32_t mLayerVersion;                //<! Version of mLayer
+    SpriteBatch mBatch;                         //<! Quads of the frame
     float mRatio;                               //<! The scaling ratio
-    std::unordered_map<
-        int, EntityInterpolation
-    > mSpritePositions;                         //<!
-    float mInterpolationFactor;                 //<!
-    sf::Clock mInterpolationClock;              //<!
+    Interpolator mInterpolator;                 //<! Smoothed entities
 
 public:
     ///////////////////////////////////////////////////////////////////////////
@@ -84,6 +73,13 @@ private:
     ///////////////////////////////////////////////////////////////////////////
     EMouseButton GetMousePress(sf::Mouse::Button click);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Draw the static tile layer, prerendering it in a render
+    /// texture only when the layer changed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void RenderLayer(void);
+
 public:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Update the graphics module
@@ -119,6 +115,14 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     virtual void LoadSpriteSheet(const std::string& path) override;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Load sprite sheet from decoded pixels
+    ///
+    /// \param sheet The decoded sprite sheet
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual void LoadSpriteSheetPixels(const PixelView& sheet) override;
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Get the name of the library
     ///
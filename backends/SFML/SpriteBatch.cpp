@@ -0,0 +1,79 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "backends/SFML/SpriteBatch.hpp"
+#include "Arcade/interfaces/IGraphicsModule.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+SpriteBatch::SpriteBatch(void)
+    : mVertices(sf::Triangles)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+void SpriteBatch::Clear(void)
+{
+    mVertices.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void SpriteBatch::Add(
+    const Sprite& sprite,
+    const sf::Vector2f& center,
+    const Color& color
+)
+{
+    float left = center.x - sprite.size.x / 2.f;
+    float top = center.y - sprite.size.y / 2.f;
+    float right = left + sprite.size.x;
+    float bottom = top + sprite.size.y;
+
+    float tile = static_cast<float>(IGraphicsModule::GRID_TILE_SIZE);
+    float texLeft = sprite.atlas.x * tile;
+    float texTop = sprite.atlas.y * tile;
+    float texRight = texLeft + sprite.size.x;
+    float texBottom = texTop + sprite.size.y;
+
+    sf::Color tint(color.r, color.g, color.b);
+
+    sf::Vertex topLeft({left, top}, tint, {texLeft, texTop});
+    sf::Vertex topRight({right, top}, tint, {texRight, texTop});
+    sf::Vertex bottomLeft({left, bottom}, tint, {texLeft, texBottom});
+    sf::Vertex bottomRight({right, bottom}, tint, {texRight, texBottom});
+
+    mVertices.append(topLeft);
+    mVertices.append(bottomLeft);
+    mVertices.append(topRight);
+    mVertices.append(topRight);
+    mVertices.append(bottomLeft);
+    mVertices.append(bottomRight);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void SpriteBatch::Draw(
+    sf::RenderTarget& target,
+    const sf::Texture& texture
+) const
+{
+    if (mVertices.getVertexCount() == 0) {
+        return;
+    }
+
+    sf::RenderStates states;
+
+    states.texture = &texture;
+    target.draw(mVertices, states);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t SpriteBatch::GetSize(void) const
+{
+    return (mVertices.getVertexCount() / 6);
+}
+
+} // namespace Arc
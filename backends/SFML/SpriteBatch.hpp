@@ -0,0 +1,81 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Arcade/core/SpriteRegistry.hpp"
+#include "Arcade/utils/Color.hpp"
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Textured quads of one sprite sheet, submitted in a single draw call
+///
+/// The vertex storage is kept between frames, so filling the batch does not
+/// allocate once it reached the size of the busiest frame.
+///
+///////////////////////////////////////////////////////////////////////////////
+class SpriteBatch
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    // Data members
+    ///////////////////////////////////////////////////////////////////////////
+    sf::VertexArray mVertices;                  //<! Two triangles per sprite
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    SpriteBatch(void);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Remove every quad while keeping the vertex storage
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Clear(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Append the quad of a sprite
+    ///
+    /// \param sprite The registered sprite
+    /// \param center The center of the sprite, in pixels
+    /// \param color The color multiplied with the texture
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Add(
+        const Sprite& sprite,
+        const sf::Vector2f& center,
+        const Color& color
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Draw every quad with one draw call
+    ///
+    /// \param target The render target
+    /// \param texture The sprite sheet the sprites come from
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void Draw(sf::RenderTarget& target, const sf::Texture& texture) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the number of sprites in the batch
+    ///
+    /// \return The number of sprites
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t GetSize(void) const;
+};
+
+} // namespace Arc
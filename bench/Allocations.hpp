@@ -0,0 +1,51 @@
+///////////////////////////////////////////////////////////////////////////////
+// Header guard
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+///////////////////////////////////////////////////////////////////////////////
+// Counting replacements of operator new and operator delete. Each benchmark
+// is a single translation unit, which includes this header once.
+///////////////////////////////////////////////////////////////////////////////
+static std::atomic<std::size_t> s_allocations{0};
+
+///////////////////////////////////////////////////////////////////////////////
+void* operator new(std::size_t size)
+{
+    s_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size ? size : 1)) {
+        return (ptr);
+    }
+    throw std::bad_alloc();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Get the number of operator new calls so far
+///
+/// \return The count since the start of the benchmark
+///
+///////////////////////////////////////////////////////////////////////////////
+static std::size_t GetAllocationCount(void)
+{
+    return (s_allocations.load(std::memory_order_relaxed));
+}
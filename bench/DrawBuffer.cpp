@@ -0,0 +1,91 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Arcade/core/API.hpp"
+#include "bench/Allocations.hpp"
+#include "games/PACMAN/Assets.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+///////////////////////////////////////////////////////////////////////////////
+//
+///////////////////////////////////////////////////////////////////////////////
+#define BENCH_WARMUP_FRAMES     16
+#define BENCH_FRAMES            2000
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Record one Pac-Man sized frame and consume it like a backend would
+///
+/// \return A checksum of the consumed commands
+///
+///////////////////////////////////////////////////////////////////////////////
+static long DrawFrame(const std::vector<SpriteHandle>& handles)
+{
+    long checksum = 0;
+
+    for (int y = 0; y < ARCADE_GAME_HEIGHT; y++) {
+        for (int x = 0; x < ARCADE_GAME_WIDTH; x++) {
+            API::Draw(
+                handles[PACMAN_MAP[y][x]],
+                Vec2i{x, y + ARCADE_OFFSET_Y}
+            );
+        }
+    }
+    for (int i = 0; i < 240; i++) {
+        API::Draw(
+            handles[TILE_PACGUM],
+            Vec2i{i % ARCADE_GAME_WIDTH, i / ARCADE_GAME_WIDTH}
+        );
+    }
+    API::Draw(SPRITES[PACMAN], Vec2f{13.5f, 23.f + ARCADE_OFFSET_Y});
+    API::SwapDrawBuffers();
+
+    Span<const Sprite> sprites = API::GetSprites();
+    for (const DrawCommand& command : API::GetDrawCommands()) {
+        const Sprite& sprite = sprites[command.sprite];
+        checksum += sprite.atlas.x + sprite.atlas.y + sprite.glyph[0];
+    }
+    return (checksum);
+}
+
+} // namespace Arc
+
+///////////////////////////////////////////////////////////////////////////////
+int main(void)
+{
+    auto handles = Arc::API::RegisterSprites(Arc::SPRITES);
+    long checksum = 0;
+
+    for (int i = 0; i < BENCH_WARMUP_FRAMES; i++) {
+        checksum += Arc::DrawFrame(handles);
+    }
+
+    std::size_t before = GetAllocationCount();
+    auto start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < BENCH_FRAMES; i++) {
+        checksum += Arc::DrawFrame(handles);
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    std::size_t allocations = GetAllocationCount() - before;
+    std::chrono::duration<double, std::micro> elapsed = end - start;
+
+    std::printf(
+        "DrawBuffer: %zu commands/frame, %zu bytes/command, %.2f us/frame, "
+        "%.3f allocations/frame (checksum %ld)\n",
+        Arc::API::GetDrawCommands().Size(),
+        sizeof(Arc::DrawCommand),
+        elapsed.count() / BENCH_FRAMES,
+        static_cast<double>(allocations) / BENCH_FRAMES,
+        checksum
+    );
+    return (allocations == 0 ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,373 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Arcade/core/API.hpp"
+#include "Arcade/core/FrameScheduler.hpp"
+#include "Arcade/core/InputLog.hpp"
+#include "Arcade/core/Library.hpp"
+#include "Arcade/core/ModuleDescriptor.hpp"
+#include "Arcade/audio/Audio.hpp"
+#include "Arcade/interfaces/IGameModule.hpp"
+#include "bench/Allocations.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+//
+///////////////////////////////////////////////////////////////////////////////
+#define BENCH_WARMUP_TICKS      120
+#define BENCH_TICKS             6000
+#define BENCH_INPUT_PERIOD      12
+#define BENCH_SEED              0x5eedull
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward namespace std::filesystem
+///////////////////////////////////////////////////////////////////////////////
+namespace fs = std::filesystem;
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief A game library to measure
+///
+///////////////////////////////////////////////////////////////////////////////
+struct Game
+{
+    std::string path;                       //<! Library path
+    std::string name;                       //<! From its descriptor
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Measures of a game
+///
+///////////////////////////////////////////////////////////////////////////////
+struct Result
+{
+    Game game;                              //<! Measured game
+    std::size_t ticks;                      //<! Measured ticks
+    double seconds;                         //<! Spent in Tick
+    std::size_t draws;                      //<! Draw commands
+    std::size_t allocations;                //<! Made in Tick
+    double p50;                             //<! Tick time, microseconds
+    double p99;                             //<! Tick time, microseconds
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Read a count from the environment
+///
+/// \param name The environment variable
+/// \param fallback The count used when the variable is unset
+///
+/// \return The count
+///
+///////////////////////////////////////////////////////////////////////////////
+static std::size_t GetCount(const char* name, std::size_t fallback)
+{
+    const char* value = std::getenv(name);
+
+    return (value ? std::strtoull(value, nullptr, 10) : fallback);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief List the game libraries of a directory, hidden ones included
+///
+/// \param directory The library directory
+///
+/// \return The games, by path
+///
+///////////////////////////////////////////////////////////////////////////////
+static std::vector<Game> FindGames(const std::string& directory)
+{
+    std::vector<Game> games;
+    std::error_code error;
+
+    for (const auto& entry : fs::directory_iterator(directory, error)) {
+        std::string path = entry.path().string();
+        std::optional<ModuleDescriptor> descriptor =
+            ReadModuleDescriptor(path);
+
+        if (descriptor && descriptor->kind == MODULE_GAME) {
+            games.push_back({path, descriptor->name});
+        }
+    }
+    std::sort(games.begin(), games.end(), [](const Game& a, const Game& b) {
+        return (a.path < b.path);
+    });
+    return (games);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Press a key now and then: start and restart the game, and walk
+/// in random directions
+///
+/// \param tick The tick index
+/// \param state The random state
+///
+///////////////////////////////////////////////////////////////////////////////
+static void PushAutopilotKey(std::size_t tick, std::uint32_t& state)
+{
+    static const EKeyboardKey DIRECTIONS[] = {
+        EKeyboardKey::UP, EKeyboardKey::DOWN,
+        EKeyboardKey::LEFT, EKeyboardKey::RIGHT
+    };
+
+    if (tick % BENCH_INPUT_PERIOD != 0) {
+        return;
+    }
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+
+    EKeyboardKey key = DIRECTIONS[state % 4];
+
+    if (tick % (BENCH_INPUT_PERIOD * 16) == 0) {
+        key = EKeyboardKey::SPACE;
+    } else if (tick % (BENCH_INPUT_PERIOD * 16) == BENCH_INPUT_PERIOD) {
+        key = EKeyboardKey::ENTER;
+    }
+    API::PushEvent(API::Event::GAME, API::Event::KeyPressed{key});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Push the logged inputs of a frame to the game, the way the core
+/// forwards them
+///
+/// \param frame The logged frame
+///
+///////////////////////////////////////////////////////////////////////////////
+static void PushLoggedInputs(const InputLog::Frame& frame)
+{
+    for (const InputLog::Input& input : frame.inputs) {
+        if (!input.event.Is<API::Event::Closed>()) {
+            API::PushEvent(API::Event::GAME, input.event);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Drop what the game sent to the core and the graphics module
+///
+///////////////////////////////////////////////////////////////////////////////
+static void DrainOutputs(void)
+{
+    API::DrainEvents(API::Event::CORE, [](API::Event&) {});
+    API::DrainEvents(API::Event::GRAPHICS, [](API::Event&) {});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Get a percentile of the tick times
+///
+/// \param times The tick times, reordered
+/// \param percentile From 0 to 1
+///
+/// \return The tick time in microseconds
+///
+///////////////////////////////////////////////////////////////////////////////
+static double Percentile(std::vector<double>& times, double percentile)
+{
+    if (times.empty()) {
+        return (0.0);
+    }
+
+    auto nth = times.begin() + static_cast<std::ptrdiff_t>(
+        percentile * (times.size() - 1)
+    );
+
+    std::nth_element(times.begin(), nth, times.end());
+    return (*nth);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Tick a game with the autopilot, or through an input log
+///
+/// \param game The game library
+/// \param games Every game name, for the menu
+/// \param logPath The input log, or nullptr for the autopilot
+///
+/// \return The measures
+///
+///////////////////////////////////////////////////////////////////////////////
+static Result RunGame(
+    const Game& game,
+    const std::vector<std::string>& games,
+    const char* logPath
+)
+{
+    std::optional<InputLog> log;
+
+    if (logPath) {
+        log.emplace(logPath, InputLog::Mode::REPLAY);
+    }
+    API::SetRandomSeed(log ? log->GetSeed() : BENCH_SEED);
+    API::ClearLayer();
+
+    std::shared_ptr<IGameModule> module = Library::Load<IGameModule>(
+        game.path
+    );
+    std::size_t warmup = log ? 0 : BENCH_WARMUP_TICKS;
+    std::size_t limit = GetCount("ARCADE_BENCH_TICKS", BENCH_TICKS);
+    float delta = 1.f / ARC_DEFAULT_TICK_RATE;
+    std::uint32_t state = static_cast<std::uint32_t>(BENCH_SEED);
+    std::vector<double> times;
+    Result result{game, 0, 0.0, 0, 0, 0.0, 0.0};
+    std::uint32_t pending = 0;
+
+    times.reserve(limit);
+    API::PushEvent(API::Event::GAME, API::Event::Libraries{
+        API::InternStrings({}), API::InternStrings(games)
+    });
+    module->BeginPlay();
+
+    for (std::size_t tick = 0; tick < warmup + limit; tick++) {
+        // A log sets the ticks of each frame, its inputs come before them
+        while (log && pending == 0) {
+            if (!log->BeginFrame()) {
+                break;
+            }
+            pending = log->GetFrame().ticks;
+            delta = log->GetFrame().tickDelta;
+            PushLoggedInputs(log->GetFrame());
+            log->EndFrame();
+        }
+        if (log && pending == 0) {
+            break;
+        }
+        if (log) {
+            pending--;
+        } else {
+            PushAutopilotKey(tick, state);
+        }
+
+        API::DiscardDrawCommands();
+
+        std::size_t allocations = GetAllocationCount();
+        auto start = std::chrono::steady_clock::now();
+
+        module->Tick(delta);
+
+        std::chrono::duration<double, std::micro> elapsed =
+            std::chrono::steady_clock::now() - start;
+
+        allocations = GetAllocationCount() - allocations;
+        API::SwapDrawBuffers();
+        DrainOutputs();
+        if (tick < warmup) {
+            continue;
+        }
+        result.ticks++;
+        result.seconds += elapsed.count() / 1e6;
+        result.draws += API::GetDrawCommands().Size();
+        result.allocations += allocations;
+        times.push_back(elapsed.count());
+    }
+
+    module->EndPlay();
+    Library::Unload(module);
+    API::DrainEvents(API::Event::GAME, [](API::Event&) {});
+    DrainOutputs();
+    result.p50 = Percentile(times, 0.50);
+    result.p99 = Percentile(times, 0.99);
+    return (result);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Print the measures as JSON
+///
+/// \param file The output
+/// \param results The measures
+/// \param logPath The input log, or nullptr for the autopilot
+///
+///////////////////////////////////////////////////////////////////////////////
+static void PrintResults(
+    std::FILE* file,
+    const std::vector<Result>& results,
+    const char* logPath
+)
+{
+    std::fprintf(file, "{\n  \"input\": \"%s\",\n  \"games\": [",
+        logPath ? logPath : "autopilot");
+    for (std::size_t i = 0; i < results.size(); i++) {
+        const Result& result = results[i];
+        double ticks = static_cast<double>(std::max<std::size_t>(
+            result.ticks, 1
+        ));
+
+        std::fprintf(file,
+            "%s\n    {\"name\": \"%s\", \"library\": \"%s\", \"ticks\": %zu, "
+            "\"ticks_per_second\": %.1f, \"draws_per_tick\": %.2f, "
+            "\"allocations_per_tick\": %.3f, \"tick_p50_us\": %.3f, "
+            "\"tick_p99_us\": %.3f}",
+            i == 0 ? "" : ",",
+            result.game.name.c_str(),
+            result.game.path.c_str(),
+            result.ticks,
+            result.seconds > 0.0 ? result.ticks / result.seconds : 0.0,
+            result.draws / ticks,
+            result.allocations / ticks,
+            result.p50,
+            result.p99
+        );
+    }
+    std::fprintf(file, "\n  ]\n}\n");
+}
+
+} // namespace Arc
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    const char* logPath = std::getenv("ARCADE_REPLAY");
+    const char* outputPath = std::getenv("ARCADE_BENCH_OUTPUT");
+    std::vector<Arc::Game> games;
+    std::vector<std::string> names;
+    std::vector<Arc::Result> results;
+
+    if (argc > 1) {
+        for (int i = 1; i < argc; i++) {
+            auto descriptor = Arc::ReadModuleDescriptor(argv[i]);
+
+            games.push_back({argv[i], descriptor ? descriptor->name : argv[i]});
+        }
+    } else {
+        games = Arc::FindGames("lib");
+    }
+    for (const Arc::Game& game : games) {
+        names.push_back(game.name);
+    }
+
+    // Sounds are played like in the arcade, without opening the device
+    // in the middle of a measure
+    Arc::Audio::Initialize();
+
+    try {
+        for (const Arc::Game& game : games) {
+            results.push_back(Arc::RunGame(game, names, logPath));
+        }
+    } catch (const std::exception& error) {
+        std::fprintf(stderr, "Games: %s\n", error.what());
+        return (EXIT_FAILURE);
+    }
+    Arc::Audio::Shutdown();
+
+    std::FILE* output = outputPath ? std::fopen(outputPath, "w") : stdout;
+
+    if (!output) {
+        std::fprintf(stderr, "Games: cannot write %s\n", outputPath);
+        return (EXIT_FAILURE);
+    }
+    Arc::PrintResults(output, results, logPath);
+    if (output != stdout) {
+        std::fclose(output);
+    }
+    return (games.empty() ? EXIT_FAILURE : EXIT_SUCCESS);
+}
@@ -0,0 +1,183 @@
+///////////////////////////////////////////////////////////////////////////////
+// Dependencies
+///////////////////////////////////////////////////////////////////////////////
+#include "Arcade/core/API.hpp"
+#include "Arcade/interfaces/IGraphicsModule.hpp"
+#include "backends/SFML/SpriteBatch.hpp"
+#include "games/PACMAN/Assets.hpp"
+#include <SFML/Graphics.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+///////////////////////////////////////////////////////////////////////////////
+//
+///////////////////////////////////////////////////////////////////////////////
+#define BENCH_WARMUP_FRAMES     16
+#define BENCH_FRAMES            500
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace Arc
+///////////////////////////////////////////////////////////////////////////////
+namespace Arc
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Record the Pac-Man scene the way the game drew it before the tile
+/// layer existed: the whole maze, every gum, the player and the ghosts
+///
+///////////////////////////////////////////////////////////////////////////////
+static void RecordScene(const std::vector<SpriteHandle>& handles)
+{
+    for (int y = 0; y < ARCADE_GAME_HEIGHT; y++) {
+        for (int x = 0; x < ARCADE_GAME_WIDTH; x++) {
+            API::Draw(
+                handles[PACMAN_MAP[y][x]],
+                Vec2i{x, y + ARCADE_OFFSET_Y}
+            );
+        }
+    }
+    for (int i = 0; i < 240; i++) {
+        API::Draw(
+            handles[TILE_PACGUM],
+            Vec2i{i % ARCADE_GAME_WIDTH, i / ARCADE_GAME_WIDTH}
+        );
+    }
+    API::Draw(handles[PACMAN], Vec2f{13.5f, 23.f + ARCADE_OFFSET_Y});
+    API::Draw(handles[RED_R1], Vec2f{13.5f, 11.f + ARCADE_OFFSET_Y});
+    API::Draw(handles[PINK_R1], Vec2f{11.5f, 14.f + ARCADE_OFFSET_Y});
+    API::Draw(handles[CYAN_R1], Vec2f{13.5f, 14.f + ARCADE_OFFSET_Y});
+    API::Draw(handles[ORANGE_R1], Vec2f{15.5f, 14.f + ARCADE_OFFSET_Y});
+    API::SwapDrawBuffers();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Previous SFML path, one sf::Sprite and one draw call per command
+///
+///////////////////////////////////////////////////////////////////////////////
+static void RenderSprites(sf::RenderTarget& target, const sf::Texture& sheet)
+{
+    unsigned int tile = IGraphicsModule::GRID_TILE_SIZE;
+    float offset = tile / 2.f;
+    Span<const Sprite> sprites = API::GetSprites();
+
+    for (const DrawCommand& draw : API::GetDrawCommands()) {
+        const Sprite& sprite = sprites[draw.sprite];
+        sf::Sprite drawable;
+
+        drawable.setTexture(sheet);
+        drawable.setTextureRect(sf::IntRect(
+            sprite.atlas.x * tile, sprite.atlas.y * tile,
+            sprite.size.x, sprite.size.y
+        ));
+        drawable.setOrigin({sprite.size.x / 2.f, sprite.size.y / 2.f});
+        drawable.setPosition(
+            draw.position.x * tile + offset,
+            draw.position.y * tile + offset
+        );
+        drawable.setColor(sf::Color(draw.color.r, draw.color.g, draw.color.b));
+        target.draw(drawable);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Batched SFML path, one vertex array and one draw call per frame
+///
+///////////////////////////////////////////////////////////////////////////////
+static void RenderBatch(
+    sf::RenderTarget& target,
+    const sf::Texture& sheet,
+    SpriteBatch& batch
+)
+{
+    unsigned int tile = IGraphicsModule::GRID_TILE_SIZE;
+    float offset = tile / 2.f;
+    Span<const Sprite> sprites = API::GetSprites();
+
+    batch.Clear();
+    for (const DrawCommand& draw : API::GetDrawCommands()) {
+        sf::Vector2f center(
+            draw.position.x * tile + offset,
+            draw.position.y * tile + offset
+        );
+
+        batch.Add(sprites[draw.sprite], center, draw.color);
+    }
+    batch.Draw(target, sheet);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Time a render path, waiting for the GPU once at the end
+///
+/// \return The average frame time in microseconds
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename Path>
+static double TimeFrames(sf::RenderTexture& target, Path&& path)
+{
+    for (int i = 0; i < BENCH_WARMUP_FRAMES; i++) {
+        target.clear();
+        path();
+        target.display();
+    }
+    target.getTexture().copyToImage();
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < BENCH_FRAMES; i++) {
+        target.clear();
+        path();
+        target.display();
+    }
+    target.getTexture().copyToImage();
+
+    auto end = std::chrono::steady_clock::now();
+    std::chrono::duration<double, std::micro> elapsed = end - start;
+
+    return (elapsed.count() / BENCH_FRAMES);
+}
+
+} // namespace Arc
+
+///////////////////////////////////////////////////////////////////////////////
+int main(void)
+{
+    unsigned int tile = Arc::IGraphicsModule::GRID_TILE_SIZE;
+    sf::RenderTexture target;
+
+    if (!target.create(
+        ARCADE_SCREEN_WIDTH * tile, ARCADE_SCREEN_HEIGHT * tile
+    )) {
+        std::printf("SFMLBatch: skipped, no OpenGL context available\n");
+        return (EXIT_SUCCESS);
+    }
+
+    sf::Texture sheet;
+
+    if (!sheet.loadFromFile("assets/PACMAN/sprites.png")) {
+        sheet.create(512, 512);
+    }
+
+    auto handles = Arc::API::RegisterSprites(Arc::SPRITES);
+    Arc::SpriteBatch batch;
+
+    Arc::RecordScene(handles);
+
+    double sprites = Arc::TimeFrames(target, [&]() {
+        Arc::RenderSprites(target, sheet);
+    });
+    double batched = Arc::TimeFrames(target, [&]() {
+        Arc::RenderBatch(target, sheet, batch);
+    });
+
+    std::printf(
+        "SFMLBatch: %zu sprites/frame, per-sprite %.2f us/frame "
+        "(%zu draw calls), batched %.2f us/frame (1 draw call), %.1fx\n",
+        Arc::API::GetDrawCommands().Size(),
+        sprites,
+        Arc::API::GetDrawCommands().Size(),
+        batched,
+        sprites / batched
+    );
+    return (EXIT_SUCCESS);
+}
@@ -25,25 +25,32 @@ MenuGUI::MenuGUI(void)
 MenuGUI::~MenuGUI()
 {}
 
+///////////////////////////////////////////////////////////////////////////////
+static const int LTRS_OFFSET_X = 107;
+static const char LTRS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ!@..0123456789/-\"";
+static const int LTRS_COUNT = sizeof(LTRS) - 1;
+static const int LTRS_ROW_SIZE = 15;
+static const Color LTS_COLORS[] = {
+    Color{224, 221, 255}, Color{255, 0, 0}, Color{252, 181, 255},
+    Color{0, 255, 255}, Color{248, 187, 85}, Color{250, 185, 176},
+    Color{255, 255, 0}, Color{0, 255, 0}
+};
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<SpriteHandle> MenuGUI::mFont;
+
 ///////////////////////////////////////////////////////////////////////////////
 void MenuGUI::Text(
-    const std::string& text,
+    std::string_view text,
     MenuGUI::TextColor color,
     const Vec2i& position
 )
 {
-    static const int LTRS_OFFSET_X = 107;
-    static const char LTRS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ!@..0123456789/-\"";
-    static const int LTRS_ROW_SIZE = 15;
-    static const Color LTS_COLORS[] = {
-        Color{224, 221, 255}, Color{255, 0, 0}, Color{252, 181, 255},
-        Color{0, 255, 255}, Color{248, 187, 85}, Color{250, 185, 176},
-        Color{255, 255, 0}, Color{0, 255, 0}
-    };
+    int offset = static_cast<int>(color) * LTRS_COUNT;
 
     for (size_t i = 0; i < text.size(); i++) {
         int index = -1;
-        for (size_t j = 0; j < sizeof(LTRS); j++) {
+        for (int j = 0; j < LTRS_COUNT; j++) {
             if (text[i] == LTRS[j]) {
                 index = j;
                 break;
@@ -54,94 +61,91 @@ void MenuGUI::Text(
             continue;
         }
 
-        int row = index / LTRS_ROW_SIZE + static_cast<int>(color) * 4;
-        int col = index % LTRS_ROW_SIZE;
-
-        IGameModule::Asset sprite(
-            {LTRS_OFFSET_X + col, row},
-            std::string(1, text[i]),
-            LTS_COLORS[static_cast<int>(color)]
+        API::Draw(
+            mFont[offset + index],
+            position + Vec2i{static_cast<int>(i), 0}
         );
-
-        API::Draw(sprite, position + Vec2i{static_cast<int>(i), 0});
     }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void MenuGUI::HandleEvents(void)
 {
-    while (auto event = API::PollEvent(API::Event::GAME)) {
-        if (auto key = event->GetIf<API::Event::KeyPressed>()) {
-            if (key->code == EKeyboardKey::SPACE) {
+    API::DispatchEvents(API::Event::GAME,
+        [this](const API::Event::KeyPressed& key) {
+            if (key.code == EKeyboardKey::SPACE) {
                 if (!mUserNameSelected) {
                     if (mUserName.size() < 2) {
-                        continue;
+                        return;
                     }
 
                     if (mUserName == "ARISE" || mUserName == "REVIVE") {
                         mAxolotl.ChangeState(Axolotl::State::ARISE);
                         mUserName.clear();
-                        continue;
+                        return;
                     }
 
                     if (mUserName == "DIE" || mUserName == "KILL") {
                         mAxolotl.ChangeState(Axolotl::State::DIE);
                         mUserName.clear();
-                        continue;
+                        return;
                     }
 
                     if (mUserName == "EAT" || mUserName == "FEED") {
                         mAxolotl.ChangeState(Axolotl::State::EAT);
                         mUserName.clear();
-                        continue;
+                        return;
                     }
 
                     if (mUserName == "DANCE") {
                         mAxolotl.ChangeState(Axolotl::State::DANCE);
                         mUserName.clear();
-                        continue;
+                        return;
                     }
 
                     mUserNameSelected = true;
-                    API::PushEvent(
-                        API::Event::CORE,
-                        API::Event::PlayerInformation({mUserName})
+                    API::PushEvent(API::Event::CORE,
+                        API::Event::PlayerInformation{
+                            API::InternString(mUserName)
+                        }
                     );
                 } else {
-                    API::PushEvent(
-                        API::Event::CORE,
-                        API::Event::SetGame{mGames[mCurrentGame]}
+                    API::PushEvent(API::Event::CORE,
+                        API::Event::SetGame{
+                            API::InternString(mGames[mCurrentGame])
+                        }
                     );
                 }
-            } else if (key->code == EKeyboardKey::ESCAPE) {
+            } else if (key.code == EKeyboardKey::ESCAPE) {
                 if (!mUserNameSelected) {
                     mUserName.clear();
                 }
-            } else if (key->code == EKeyboardKey::LEFT) {
+            } else if (key.code == EKeyboardKey::LEFT) {
                 mCurrentGame--;
                 if (mCurrentGame < 0) {
                     mCurrentGame = static_cast<int>(mGames.size() - 1);
                 }
-            } else if (key->code == EKeyboardKey::RIGHT) {
+            } else if (key.code == EKeyboardKey::RIGHT) {
                 mCurrentGame++;
                 if (mCurrentGame > static_cast<int>(mGames.size() - 1)) {
                     mCurrentGame = 0;
                 }
             } else if (
-                key->code >= EKeyboardKey::A &&
-                key->code <= EKeyboardKey::Z &&
+                key.code >= EKeyboardKey::A &&
+                key.code <= EKeyboardKey::Z &&
                 mUserName.length() < 10
             ) {
                 mUserName += ('A' +
-                    static_cast<int>(key->code) -
+                    static_cast<int>(key.code) -
                     static_cast<int>(EKeyboardKey::A)
                 );
             }
-        } else if (auto libraries = event->GetIf<API::Event::Libraries>()) {
-            mGames = libraries->games;
-            mGraphicals = libraries->graphicals;
+        },
+        [this](const API::Event::Libraries& libraries) {
+            mGames = API::GetStrings(libraries.games);
+            mGraphicals = API::GetStrings(libraries.graphicals);
         }
-    }
+    );
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -260,10 +264,11 @@ void MenuGUI::DrawUsernameSelection(void)
 ///////////////////////////////////////////////////////////////////////////////
 void MenuGUI::DrawGameSelection(void)
 {
-    IGameModule::Asset gamePoster = SPRITES[GAME_UNKNOWN];
+    SpriteHandle gamePoster = mSprites[GAME_UNKNOWN];
+    auto poster = SPRITE_MAP.find(mGames[mCurrentGame]);
 
-    if (SPRITE_MAP.count(mGames[mCurrentGame])) {
-        gamePoster = SPRITES[SPRITE_MAP.at(mGames[mCurrentGame])];
+    if (poster != SPRITE_MAP.end()) {
+        gamePoster = mSprites[poster->second];
     }
     API::Draw(gamePoster, Vec2i({15, 16}));
     Text(mGames[mCurrentGame], TextColor::TEXT_WHITE, Vec2i({3, 34}));
@@ -278,6 +283,23 @@ void MenuGUI::DrawGameSelection(void)
 ///////////////////////////////////////////////////////////////////////////////
 void MenuGUI::BeginPlay(void)
 {
+    int colors = sizeof(LTS_COLORS) / sizeof(LTS_COLORS[0]);
+
+    mSprites = API::RegisterSprites(SPRITES);
+    mFont.clear();
+    for (int color = 0; color < colors; color++) {
+        for (int index = 0; index < LTRS_COUNT; index++) {
+            int row = index / LTRS_ROW_SIZE + color * 4;
+            int col = index % LTRS_ROW_SIZE;
+
+            mFont.push_back(API::RegisterSprite(IGameModule::Asset(
+                {LTRS_OFFSET_X + col, row},
+                std::string(1, LTRS[index]),
+                LTS_COLORS[color]
+            )));
+        }
+    }
+
     API::PushEvent(API::Event::GRAPHICS, API::Event::GridSize({30, 36}));
 }
 
@@ -8,8 +8,10 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "Arcade/interfaces/IGameModule.hpp"
 #include "Arcade/utils/Vec2.hpp"
+#include "Arcade/core/SpriteRegistry.hpp"
 #include "games/GUI_MENU/Axolotl.hpp"
 #include <string>
+#include <string_view>
 #include <memory>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -53,6 +55,9 @@ private:
     std::string mUserName;                  //<!
     bool mUserNameSelected;                 //<!
     Axolotl mAxolotl;                       //<!
+    std::vector<SpriteHandle> mSprites;     //<! Handles of SPRITES
+
+    static std::vector<SpriteHandle> mFont; //<! Glyph handles, per color
 
 public:
     ///////////////////////////////////////////////////////////////////////////
@@ -77,7 +82,7 @@ private:
     ///
     ///////////////////////////////////////////////////////////////////////////
     static void Text(
-        const std::string& text,
+        std::string_view text,
         TextColor color,
         const Vec2i& position
     );
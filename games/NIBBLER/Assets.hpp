@@ -7,6 +7,7 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "Arcade/interfaces/IGameModule.hpp"
+#include "Arcade/core/SpriteRegistry.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Arc
@@ -25,6 +26,9 @@ namespace Arc
 ///////////////////////////////////////////////////////////////////////////////
 //
 ///////////////////////////////////////////////////////////////////////////////
+#define FONT_OFFSET_Y           13
+#define FONT_ROW_SIZE           27
+#define FONT_COLOR_COUNT        7
 #define SFX_CRASH   "assets/NIBBLER/sfx/crash.wav"
 #define SFX_EAT     "assets/NIBBLER/sfx/eat.wav"
 #define SFX_TURN    "assets/NIBBLER/sfx/turn.wav"
@@ -143,4 +147,16 @@ static const std::vector<IGameModule::Asset> SPRITES = {
     IGameModule::Asset({27, 21}, "()", CLR_RED, {104, 104})       //<! GAME_MASCOT
 };
 
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Registered handles of SPRITES, filled by Core::BeginPlay
+///
+///////////////////////////////////////////////////////////////////////////////
+inline std::vector<SpriteHandle> SPRITE_HANDLES;
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Registered font glyphs, two rows of FONT_ROW_SIZE per color
+///
+///////////////////////////////////////////////////////////////////////////////
+inline std::vector<SpriteHandle> FONT_HANDLES;
+
 } // namespace Arc
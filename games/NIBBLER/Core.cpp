@@ -32,9 +32,49 @@ Core::~Core()
     mGameState.reset();
 }
 
+///////////////////////////////////////////////////////////////////////////////
+static void RegisterFont(void)
+{
+    static const Color LTS_COLORS[] = {
+        Color{255, 255, 222}, Color{0, 184, 151}, Color{255, 0, 0},
+        Color{255, 255, 0}, Color{204, 29, 243}, Color{5, 12, 196},
+        Color{168, 168, 139}
+    };
+
+    FONT_HANDLES.assign(FONT_COLOR_COUNT * FONT_ROW_SIZE * 2, 0);
+    for (int color = 0; color < FONT_COLOR_COUNT; color++) {
+        for (int row = 0; row < 2; row++) {
+            for (int col = 0; col < FONT_ROW_SIZE; col++) {
+                char glyph = 0;
+
+                if (row == 0) {
+                    glyph = col < 26 ? static_cast<char>('A' + col) : '@';
+                } else if (col < 10) {
+                    glyph = static_cast<char>('0' + col);
+                } else if (col == 10) {
+                    glyph = ',';
+                } else {
+                    continue;
+                }
+
+                FONT_HANDLES[(color * 2 + row) * FONT_ROW_SIZE + col] =
+                    API::RegisterSprite(IGameModule::Asset(
+                        {col, FONT_OFFSET_Y + row + color * 2},
+                        std::string(1, glyph),
+                        LTS_COLORS[color]
+                    ));
+            }
+        }
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 void Core::BeginPlay(void)
 {
+    SPRITE_HANDLES = API::RegisterSprites(SPRITES);
+    Maps::RegisterSprites();
+    RegisterFont();
+
     API::PushEvent(API::Event::GRAPHICS, API::Event::GridSize({
         ARCADE_SCREEN_WIDTH, ARCADE_SCREEN_HEIGHT
     }));
@@ -51,9 +91,9 @@ void Core::EndPlay(void)
 void Core::Tick(float deltaSeconds)
 {
     if (!mInGame) {
-        while (auto event = API::PollEvent(API::Event::GAME)) {
-            if (auto key = event->GetIf<API::Event::KeyPressed>()) {
-                if (key->code == EKeyboardKey::SPACE) {
+        API::DispatchEvents(API::Event::GAME,
+            [this](const API::Event::KeyPressed& key) {
+                if (key.code == EKeyboardKey::SPACE) {
                     Menu* menu = reinterpret_cast<Menu*>(mGameState.get());
                     if (!menu->ToggleInstruction()) {
                         mInGame = true;
@@ -62,14 +102,14 @@ void Core::Tick(float deltaSeconds)
                         mGameState->BeginPlay();
                     }
                 }
-            } else if (auto gameOver = event->GetIf<API::Event::GameOver>()) {
-                (void)gameOver;
+            },
+            [this](const API::Event::GameOver&) {
                 mInGame = false;
                 mGameState->EndPlay();
                 mGameState.reset(new Menu());
                 mGameState->BeginPlay();
             }
-        }
+        );
     }
 
     mGameState->Tick(deltaSeconds);
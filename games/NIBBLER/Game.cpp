@@ -7,7 +7,6 @@
 #include "games/NIBBLER/Maps/Map.hpp"
 #include <iostream>
 #include <cstdlib>
-#include <ctime>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Arc
@@ -26,7 +25,7 @@ Game::Game(void)
     , mAnimationTimer(0.f)
 {
     // Initialize random seed
-    std::srand(static_cast<unsigned int>(std::time(nullptr)));
+    std::srand(API::NextRandomSeed());
 
     // Create snake, map, and fruits
     mSnake = std::make_unique<Snake>();
@@ -54,7 +53,9 @@ void Game::BeginPlay(void)
 
 ///////////////////////////////////////////////////////////////////////////////
 void Game::EndPlay(void)
-{}
+{
+    API::ClearLayer();
+}
 
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -64,7 +65,7 @@ void Game::DrawSpawningAnimation(void)
 
     for (int y = 0; y < 3; y++) {
         for (int i = progress; i < 11; i++) {
-            API::Draw(SPRITES[TRON_SQUARE], Vec2i(7 + i, 28 + y));
+            API::Draw(SPRITE_HANDLES[TRON_SQUARE], Vec2i(7 + i, 28 + y));
         }
     }
 }
@@ -145,17 +146,12 @@ void Game::Tick(float deltaSeconds)
 
 ///////////////////////////////////////////////////////////////////////////////
 void Game::Text(
-    const std::string& text,
+    std::string_view text,
     Game::TextColor color,
     const Vec2i& position
 )
 {
-    static const int LTRS_OFFSET_Y = 13;
-    static const Color LTS_COLORS[] = {
-        Color{255, 255, 222}, Color{0, 184, 151}, Color{255, 0, 0},
-        Color{255, 255, 0}, Color{204, 29, 243}, Color{5, 12, 196},
-        Color{168, 168, 139}
-    };
+    int offset = static_cast<int>(color) * FONT_ROW_SIZE * 2;
 
     for (size_t i = 0; i < text.size(); i++) {
         int row = 0;
@@ -176,21 +172,18 @@ void Game::Text(
             continue;
         }
 
-        IGameModule::Asset sprite(
-            {col, LTRS_OFFSET_Y + row + static_cast<int>(color) * 2},
-            std::string(1, text[i]),
-            LTS_COLORS[static_cast<int>(color)]
+        API::Draw(
+            FONT_HANDLES[offset + row * FONT_ROW_SIZE + col],
+            position + Vec2i{static_cast<int>(i), 0}
         );
-
-        API::Draw(sprite, position + Vec2i{static_cast<int>(i), 0});
     }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void Game::DrawScore(void)
 {
-    API::Draw(SPRITES[TEXT_PLAYER], Vec2i(1, 0));
-    API::Draw(SPRITES[TEXT_1], Vec2i(3, 0));
+    API::Draw(SPRITE_HANDLES[TEXT_PLAYER], Vec2i(1, 0));
+    API::Draw(SPRITE_HANDLES[TEXT_1], Vec2i(3, 0));
     int place = 0;
     if (mScore > 9999) {
         place = 2;
@@ -199,10 +192,10 @@ void Game::DrawScore(void)
     }
     Text(std::to_string(mScore), TextColor::TEXT_WHITE, {15 - place, 0});
 
-    API::Draw(SPRITES[TEXT_LEFT], Vec2i(22, 0));
+    API::Draw(SPRITE_HANDLES[TEXT_LEFT], Vec2i(22, 0));
     Text(std::to_string(mLifes), TextColor::TEXT_WHITE, {26, 0});
 
-    API::Draw(SPRITES[TEXT_HISCORE], Vec2i(2, 3));
+    API::Draw(SPRITE_HANDLES[TEXT_HISCORE], Vec2i(2, 3));
     Text("50,000", TextColor::TEXT_CYAN, {10, 3});
 
     Text("TIME", TextColor::TEXT_YELLOW, {19, 3});
@@ -282,24 +275,24 @@ void Game::HandleEvents(void)
     Vec2i desiredDirection(0);
 
     // Process input events
-    while (auto event = API::PollEvent(API::Event::GAME)) {
-        if (auto key = event->GetIf<API::Event::KeyPressed>()) {
+    API::DispatchEvents(API::Event::GAME,
+        [&](const API::Event::KeyPressed& key) {
             // Handle key presses based on game state
             switch (mState) {
                 case State::PRESS_START:
-                    if (key->code == EKeyboardKey::SPACE) {
+                    if (key.code == EKeyboardKey::SPACE) {
                         mState = State::START_PRESSED;
                         mAnimationTimer = 0.f;
                     }
                     break;
                 case State::PLAYING:
-                    if (key->code == EKeyboardKey::UP) {
+                    if (key.code == EKeyboardKey::UP) {
                         desiredDirection = Vec2i{0, -1};
-                    } else if (key->code == EKeyboardKey::DOWN) {
+                    } else if (key.code == EKeyboardKey::DOWN) {
                         desiredDirection = Vec2i{0, 1};
-                    } else if (key->code == EKeyboardKey::LEFT) {
+                    } else if (key.code == EKeyboardKey::LEFT) {
                         desiredDirection = Vec2i{-1, 0};
-                    } else if (key->code == EKeyboardKey::RIGHT) {
+                    } else if (key.code == EKeyboardKey::RIGHT) {
                         desiredDirection = Vec2i{1, 0};
                     }
                     if (desiredDirection != 0) {
@@ -313,7 +306,7 @@ void Game::HandleEvents(void)
                     break;
             }
         }
-    }
+    );
 }
 
 ///////////////////////////////////////////////////////////////////////////////
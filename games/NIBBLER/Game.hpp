@@ -14,6 +14,7 @@
 #include "games/NIBBLER/Fruit.hpp"
 #include <map>
 #include <memory>
+#include <string_view>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Arc
@@ -146,7 +147,7 @@ private:
     ///
     ///////////////////////////////////////////////////////////////////////////
     void Text(
-        const std::string& text,
+        std::string_view text,
         Game::TextColor color,
         const Vec2i& position
     );
@@ -13,10 +13,16 @@
 namespace Arc::Nibbler
 {
 
+///////////////////////////////////////////////////////////////////////////////
+std::vector<SpriteHandle> Maps::mTiles[4];
+
 ///////////////////////////////////////////////////////////////////////////////
 Maps::Maps(void)
     : mLevel(0)
     , mBorderColor(Border_Color::WHITE)
+    , mLayerLevel(-1)
+    , mLayerColor(Border_Color::WHITE)
+    , mLayerVersion(0)
 {}
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -49,14 +55,45 @@ int Maps::GetLevel(void) const
 ///////////////////////////////////////////////////////////////////////////////
 void Maps::DrawMap(int level)
 {
-    int borderColor = static_cast<int>(mBorderColor);
+    const TileLayer& layer = API::GetLayer();
+
+    if (!layer.IsEmpty() && layer.GetVersion() == mLayerVersion &&
+        mLayerLevel == level && mLayerColor == mBorderColor
+    ) {
+        return;
+    }
 
-    // Draw the map based on the level
+    const auto& handles = mTiles[static_cast<int>(mBorderColor) / 3];
+    const auto& map = MAPS[level % MAPS.size()];
+    std::vector<SpriteHandle> tiles;
+
+    // Upload the map based on the level, stored column-major in MAPS
+    tiles.reserve(27 * 27);
     for (int y = 0; y < 27; y++) {
         for (int x = 0; x < 27; x++) {
-            auto sprite = SPRITES[MAPS[level % MAPS.size()][x][y]];
-            sprite.position.x += borderColor;
-            API::Draw(sprite, Vec2i{x, y + ARCADE_OFFSET_Y});
+            tiles.push_back(handles[map[x][y]]);
+        }
+    }
+
+    mLayerVersion = API::UploadLayer(tiles, 27, 27, Vec2i{0, ARCADE_OFFSET_Y});
+    mLayerLevel = level;
+    mLayerColor = mBorderColor;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Maps::RegisterSprites(void)
+{
+    for (int color = 0; color < 4; color++) {
+        mTiles[color].assign(SPRITES.size(), 0);
+        for (const auto& map : MAPS) {
+            for (const auto& column : map) {
+                for (SpriteType type : column) {
+                    IGameModule::Asset sprite = SPRITES[type];
+
+                    sprite.position.x += color * 3;
+                    mTiles[color][type] = API::RegisterSprite(sprite);
+                }
+            }
         }
     }
 }
@@ -8,6 +8,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "../../Arcade/utils/Vec2.hpp"
 #include "games/NIBBLER/Assets.hpp"
+#include <cstdint>
 
 namespace Arc::Nibbler
 {
@@ -30,6 +31,11 @@ private:
     ///////////////////////////////////////////////////////////////////////////
     int mLevel; //<! Current level
     Border_Color mBorderColor; //<! Border color
+    int mLayerLevel; //<! Level held by the tile layer
+    Border_Color mLayerColor; //<! Border color held by the tile layer
+    std::uint32_t mLayerVersion; //<! Tile layer version after the upload
+
+    static std::vector<SpriteHandle> mTiles[4]; //<! Tile handles per color
 
 public:
     ///////////////////////////////////////////////////////////////////////////
@@ -53,13 +59,20 @@ public:
     int GetLevel(void) const;
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Keep the static tile layer in sync with the level maze
+    ///
+    /// The maze is only uploaded when the level or the border color changes.
     ///
     /// \param level
     ///
     ///////////////////////////////////////////////////////////////////////////
     void DrawMap(int level);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Register the maze tiles of every border color
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void RegisterSprites(void);
 };
 
 } // namespace Arc::Nibbler
@@ -27,17 +27,12 @@ void Menu::BeginPlay(void)
 
 ///////////////////////////////////////////////////////////////////////////////
 void Menu::Text(
-    const std::string& text,
+    std::string_view text,
     Menu::TextColor color,
     const Vec2i& position
 )
 {
-    static const int LTRS_OFFSET_Y = 13;
-    static const Color LTS_COLORS[] = {
-        Color{255, 255, 222}, Color{0, 184, 151}, Color{255, 0, 0},
-        Color{255, 255, 0}, Color{204, 29, 243}, Color{5, 12, 196},
-        Color{168, 168, 139}
-    };
+    int offset = static_cast<int>(color) * FONT_ROW_SIZE * 2;
 
     for (size_t i = 0; i < text.size(); i++) {
         int row = 0;
@@ -58,34 +53,31 @@ void Menu::Text(
             continue;
         }
 
-        IGameModule::Asset sprite(
-            {col, LTRS_OFFSET_Y + row + static_cast<int>(color) * 2},
-            std::string(1, text[i]),
-            LTS_COLORS[static_cast<int>(color)]
+        API::Draw(
+            FONT_HANDLES[offset + row * FONT_ROW_SIZE + col],
+            position + Vec2i{static_cast<int>(i), 0}
         );
-
-        API::Draw(sprite, position + Vec2i{static_cast<int>(i), 0});
     }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void Menu::DrawGameInformation(void)
 {
-    API::Draw(SPRITES[TEXT_PLAYER], Vec2i(1, 0));
-    API::Draw(SPRITES[TEXT_1], Vec2i(3, 0));
+    API::Draw(SPRITE_HANDLES[TEXT_PLAYER], Vec2i(1, 0));
+    API::Draw(SPRITE_HANDLES[TEXT_1], Vec2i(3, 0));
     Text("0", TextColor::TEXT_WHITE, {15, 0});
 
-    API::Draw(SPRITES[TEXT_LEFT], Vec2i(22, 0));
+    API::Draw(SPRITE_HANDLES[TEXT_LEFT], Vec2i(22, 0));
     Text("0", TextColor::TEXT_WHITE, {26, 0});
 
-    API::Draw(SPRITES[TEXT_PLAYER], Vec2i(1, 1));
-    API::Draw(SPRITES[TEXT_2], Vec2i(3, 1));
+    API::Draw(SPRITE_HANDLES[TEXT_PLAYER], Vec2i(1, 1));
+    API::Draw(SPRITE_HANDLES[TEXT_2], Vec2i(3, 1));
     Text("0", TextColor::TEXT_WHITE, {15, 1});
 
-    API::Draw(SPRITES[TEXT_LEFT], Vec2i(22, 1));
+    API::Draw(SPRITE_HANDLES[TEXT_LEFT], Vec2i(22, 1));
     Text("0", TextColor::TEXT_WHITE, {26, 1});
 
-    API::Draw(SPRITES[TEXT_HISCORE], Vec2i(2, 3));
+    API::Draw(SPRITE_HANDLES[TEXT_HISCORE], Vec2i(2, 3));
     Text("50,000", TextColor::TEXT_CYAN, {10, 3});
 
     Text("TIME", TextColor::TEXT_YELLOW, {19, 3});
@@ -163,14 +155,14 @@ void Menu::DrawTitleScreen(void)
 {
     DrawGameInformation();
 
-    API::Draw(SPRITES[GAME_NAME], Vec2i(14, 7));
-    API::Draw(SPRITES[GAME_MASCOT], Vec2i(14, 18));
+    API::Draw(SPRITE_HANDLES[GAME_NAME], Vec2i(14, 7));
+    API::Draw(SPRITE_HANDLES[GAME_MASCOT], Vec2i(14, 18));
 
     int progress = mTimer / 1.5f * 26;
 
     for (int i = progress; i < 26; i++) {
         for (int y = 0; y < 22; y++) {
-            API::Draw(SPRITES[TRON_SQUARE], Vec2i(1 + i, 4 + y));
+            API::Draw(SPRITE_HANDLES[TRON_SQUARE], Vec2i(1 + i, 4 + y));
         }
     }
 
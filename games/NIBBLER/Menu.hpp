@@ -7,6 +7,7 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "Arcade/interfaces/IGameState.hpp"
+#include <string_view>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Arc::Nibbler
@@ -64,7 +65,7 @@ private:
     ///
     ///////////////////////////////////////////////////////////////////////////
     static void Text(
-        const std::string& text,
+        std::string_view text,
         TextColor color,
         const Vec2i& position
     );
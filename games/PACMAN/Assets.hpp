@@ -7,6 +7,7 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "Arcade/interfaces/IGameModule.hpp"
+#include "Arcade/core/SpriteRegistry.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Arc
@@ -258,6 +259,18 @@ static const std::vector<IGameModule::Asset> SPRITES = {
     IGameModule::Asset({24, 20}, "5000", CLR_WHITE, {32, 16}),   //<! SCORE_5000
 };
 
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Registered handles of SPRITES, filled by Core::BeginPlay
+///
+///////////////////////////////////////////////////////////////////////////////
+inline std::vector<SpriteHandle> SPRITE_HANDLES;
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Registered handles of the white flashing maze tiles
+///
+///////////////////////////////////////////////////////////////////////////////
+inline std::vector<SpriteHandle> WHITE_MAP_HANDLES;
+
 ///////////////////////////////////////////////////////////////////////////////
 /// \brief
 ///
@@ -18,6 +18,7 @@ namespace Arc::Pacman
 Core::Core(void)
     : mGameState(nullptr)
     , mInGame(false)
+    , mBestScore(0)
 {
     mGameState.reset(new Menu(true));
     mGameState->BeginPlay();
@@ -32,6 +33,18 @@ Core::~Core()
 ///////////////////////////////////////////////////////////////////////////////
 void Core::BeginPlay(void)
 {
+    SPRITE_HANDLES = API::RegisterSprites(SPRITES);
+    WHITE_MAP_HANDLES = SPRITE_HANDLES;
+    for (const auto& row : PACMAN_MAP) {
+        for (SpriteType type : row) {
+            IGameModule::Asset sprite = SPRITES[type];
+
+            sprite.position.x += PACMAN_WHITE_MAP_OFFSET;
+            WHITE_MAP_HANDLES[type] = API::RegisterSprite(sprite);
+        }
+    }
+    Menu::RegisterFont();
+
     API::PushEvent(API::Event::GRAPHICS, API::Event::GridSize({
         ARCADE_SCREEN_WIDTH, ARCADE_SCREEN_HEIGHT
     }));
@@ -48,31 +61,38 @@ void Core::EndPlay(void)
 void Core::Tick(float deltaSeconds)
 {
     if (!mInGame) {
-        while (auto event = API::PollEvent(API::Event::GAME)) {
-            if (auto key = event->GetIf<API::Event::KeyPressed>()) {
-                if (key->code == EKeyboardKey::SPACE) {
+        API::DispatchEvents(API::Event::GAME,
+            [this](const API::Event::KeyPressed& key) {
+                if (key.code == EKeyboardKey::SPACE) {
                     mInGame = true;
                     mGameState->EndPlay();
-                    mGameState.reset(new Game());
+                    mGameState.reset(new Game(mBestScore));
                     mGameState->BeginPlay();
                 }
+            },
+            [this](const API::Event::BestScore& best) {
+                mBestScore = best.score;
             }
-        }
+        );
     }
 
     if (mInGame) {
         auto game = dynamic_cast<Game*>(mGameState.get());
         if (game && game->IsGameOver()) {
-            while (auto event = API::PollEvent(API::Event::GAME)) {
-                if (auto key = event->GetIf<API::Event::KeyPressed>()) {
-                    if (key->code == EKeyboardKey::SPACE) {
+            API::DispatchEvents(API::Event::GAME,
+                [this, game](const API::Event::KeyPressed& key) {
+                    if (key.code == EKeyboardKey::SPACE && mInGame) {
+                        mBestScore = game->GetBestScore();
                         mInGame = false;
                         mGameState->EndPlay();
                         mGameState.reset(new Menu(false));
                         mGameState->BeginPlay();
                     }
+                },
+                [this](const API::Event::BestScore& best) {
+                    mBestScore = best.score;
                 }
-            }
+            );
         }
     }
 
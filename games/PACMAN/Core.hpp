@@ -28,6 +28,7 @@ private:
     ///////////////////////////////////////////////////////////////////////////
     std::unique_ptr<IGameState> mGameState;     //<!
     bool mInGame;                               //<!
+    int mBestScore;                             //<! Kept across games
 
 public:
     ///////////////////////////////////////////////////////////////////////////
@@ -7,6 +7,7 @@
 #include "../../Arcade/interfaces/IGameModule.hpp"
 #include "../../Arcade/core/API.hpp"
 #include "games/PACMAN/Random.hpp"
+#include "../../Arcade/core/Profiler.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Arc::Pacman
@@ -30,7 +31,7 @@ const std::vector<float> Game::MODES[3] = {
 };
 
 ///////////////////////////////////////////////////////////////////////////////
-Game::Game(void)
+Game::Game(int bestScore)
     : mTimer(0.f)
     , mState(State::PRESS_START)
     , mScore(0)
@@ -44,8 +45,12 @@ Game::Game(void)
     , mSoundTimer(0.f)
     , mAnimationTimer(0.f)
     , mShowWhiteMap(false)
-    , mBestScore(0)
-{}
+    , mLayerIsWhite(false)
+    , mLayerVersion(0)
+    , mBestScore(bestScore)
+{
+    RNG::SetSeed(API::NextRandomSeed());
+}
 
 ///////////////////////////////////////////////////////////////////////////////
 Game::~Game()
@@ -81,18 +86,34 @@ void Game::SetDefaultGums(void)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Game::DrawMapBaseLayer(void)
+void Game::UploadMapLayer(void)
 {
+    const auto& handles = mShowWhiteMap ? WHITE_MAP_HANDLES : SPRITE_HANDLES;
+    std::vector<SpriteHandle> tiles;
+
+    tiles.reserve(ARCADE_GAME_WIDTH * ARCADE_GAME_HEIGHT);
     for (int y = 0; y < ARCADE_GAME_HEIGHT; y++) {
         for (int x = 0; x < ARCADE_GAME_WIDTH; x++) {
-            auto sprite = SPRITES[PACMAN_MAP[y][x]];
+            tiles.push_back(handles[PACMAN_MAP[y][x]]);
+        }
+    }
 
-            if (mShowWhiteMap) {
-                sprite.position.x += PACMAN_WHITE_MAP_OFFSET;
-            }
+    mLayerVersion = API::UploadLayer(
+        tiles, ARCADE_GAME_WIDTH, ARCADE_GAME_HEIGHT,
+        Vec2i{0, ARCADE_OFFSET_Y}
+    );
+    mLayerIsWhite = mShowWhiteMap;
+}
 
-            API::Draw(sprite, Vec2i{x, y + ARCADE_OFFSET_Y});
-        }
+///////////////////////////////////////////////////////////////////////////////
+void Game::DrawMapBaseLayer(void)
+{
+    const TileLayer& layer = API::GetLayer();
+
+    if (layer.IsEmpty() || layer.GetVersion() != mLayerVersion ||
+        mLayerIsWhite != mShowWhiteMap
+    ) {
+        UploadMapLayer();
     }
 
     if (mState != State::PLAYING && mState != State::DEATH_ANIMATION) {
@@ -134,8 +155,8 @@ void Game::DrawScore(void)
         Vec2i{7 - static_cast<int>(score.size()), 1}
     );
 
-    std::string bestScore = std::to_string(mBestScore);
-    if (mBestScore < 10) {
+    std::string bestScore = std::to_string(GetBestScore());
+    if (GetBestScore() < 10) {
         bestScore = "0" + bestScore;
     }
 
@@ -156,9 +177,9 @@ void Game::DrawGums(void)
         );
 
         if (type == GumType::SMALL) {
-            API::Draw(SPRITES[TILE_POINT], position);
+            API::Draw(SPRITE_HANDLES[TILE_POINT], position);
         } else {
-            API::Draw(SPRITES[TILE_PACGUM], position);
+            API::Draw(SPRITE_HANDLES[TILE_PACGUM], position);
         }
     }
 }
@@ -177,7 +198,7 @@ void Game::DrawEatScore(void)
         }
 
         API::Draw(
-            SPRITES[SCORES[static_cast<int>(std::log2(score / 200))]],
+            SPRITE_HANDLES[SCORES[static_cast<int>(std::log2(score / 200))]],
             std::get<1>(timer) + Vec2i(0, ARCADE_OFFSET_Y)
         );
     }
@@ -190,22 +211,22 @@ void Game::DrawEatScore(void)
 ///////////////////////////////////////////////////////////////////////////////
 void Game::HandleEvents(void)
 {
-    while (auto event = API::PollEvent(API::Event::GAME)) {
-        if (auto key = event->GetIf<API::Event::KeyPressed>()) {
+    API::DispatchEvents(API::Event::GAME,
+        [this](const API::Event::KeyPressed& key) {
 
             Vec2i direction(0);
 
-            if (key->code == EKeyboardKey::UP) {
+            if (key.code == EKeyboardKey::UP) {
                 direction = Vec2i{0, -1};
-            } else if (key->code == EKeyboardKey::DOWN) {
+            } else if (key.code == EKeyboardKey::DOWN) {
                 direction = Vec2i{0, 1};
-            } else if (key->code == EKeyboardKey::LEFT) {
+            } else if (key.code == EKeyboardKey::LEFT) {
                 direction = Vec2i{-1, 0};
-            } else if (key->code == EKeyboardKey::RIGHT) {
+            } else if (key.code == EKeyboardKey::RIGHT) {
                 direction = Vec2i{1, 0};
             }
 
-            if (mState == State::GAME_OVER && key->code == EKeyboardKey::SPACE) {
+            if (mState == State::GAME_OVER && key.code == EKeyboardKey::SPACE) {
 
             }
 
@@ -217,10 +238,11 @@ void Game::HandleEvents(void)
             if (direction != 0 && mState == State::PLAYING) {
                 mPlayer->SetDesiredDirection(direction);
             }
-        } else if (auto best = event->GetIf<API::Event::BestScore>()) {
-            mBestScore = best->score > mScore ? best->score : mScore;
+        },
+        [this](const API::Event::BestScore& best) {
+            mBestScore = best.score;
         }
-    }
+    );
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -229,6 +251,12 @@ bool Game::IsGameOver(void) const
     return (mState == State::GAME_OVER);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+int Game::GetBestScore(void) const
+{
+    return (mBestScore > mScore ? mBestScore : mScore);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 void Game::HandlePowerPill(float deltaSeconds)
 {
@@ -582,6 +610,8 @@ void Game::Tick(float deltaSeconds)
 
     // Updating
     if (mState == State::PLAYING) {
+        ARC_PROFILE_ZONE("Pacman::Update");
+
         HandleAmbiantSound();
         HandlePowerPill(deltaSeconds);
         if (mEatTimer.size() == 0 && mAnimationTimer == 0.f) {
@@ -602,6 +632,8 @@ void Game::Tick(float deltaSeconds)
     }
 
     // Drawing
+    ARC_PROFILE_ZONE("Pacman::Draw");
+
     DrawMapBaseLayer();
     DrawPacmanLives();
     DrawGums();
@@ -641,6 +673,7 @@ void Game::Tick(float deltaSeconds)
 ///////////////////////////////////////////////////////////////////////////////
 void Game::EndPlay(void)
 {
+    API::ClearLayer();
     mGums.clear();
     mPlayer.reset();
     mBlinky.reset();
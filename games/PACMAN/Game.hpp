@@ -9,6 +9,7 @@
 #include "../../Arcade/interfaces/IGameState.hpp"
 #include "games/PACMAN/Player.hpp"
 #include "games/PACMAN/Ghost.hpp"
+#include <cstdint>
 #include <map>
 #include <memory>
 
@@ -97,14 +98,18 @@ private:
     float mSoundTimer;                                  //<!
     float mAnimationTimer;                              //<!
     bool mShowWhiteMap;                                 //<!
+    bool mLayerIsWhite;                                 //<!
+    std::uint32_t mLayerVersion;                        //<!
     int mBestScore;                                     //<!
 
 public:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
+    /// \param bestScore The best score known when the game starts
+    ///
     ///////////////////////////////////////////////////////////////////////////
-    Game(void);
+    Game(int bestScore = 0);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -119,6 +124,12 @@ private:
     ///////////////////////////////////////////////////////////////////////////
     void SetDefaultGums(void);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Upload the maze to the static tile layer
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void UploadMapLayer(void);
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -225,6 +236,14 @@ public:
     ///
     ///////////////////////////////////////////////////////////////////////////
     bool IsGameOver(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return The best score, including the current game
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    int GetBestScore(void) const;
 };
 
 } // namespace Arc::Pacman
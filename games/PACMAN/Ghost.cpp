@@ -458,10 +458,6 @@ void Ghost::ResetCounter(void)
 ///////////////////////////////////////////////////////////////////////////////
 void Ghost::Draw(float timer)
 {
-    static const Color GHOST_COLORS[] = {
-        CLR_RED, CLR_PINK, CLR_CYAN, CLR_ORANGE
-    };
-
     int index = static_cast<int>(mType);
     int flickering = static_cast<int>(timer * 8) % 2 ? 2 : 0;
     int directionOffset = 0;
@@ -482,10 +478,9 @@ void Ghost::Draw(float timer)
         case State::CHASE:
         case State::SCATTER:
             API::Draw(
-                IGameModule::Asset(
-                    {12 + directionOffset + flickering, index * 2},
-                    "/\\", GHOST_COLORS[index], {16, 16}
-                ),
+                SPRITE_HANDLES[
+                    RED_R1 + index * 8 + (directionOffset + flickering) / 2
+                ],
                 position
             );
             break;
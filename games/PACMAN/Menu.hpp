@@ -7,6 +7,9 @@
 // Dependencies
 ///////////////////////////////////////////////////////////////////////////////
 #include "../../Arcade/interfaces/IGameState.hpp"
+#include "../../Arcade/core/SpriteRegistry.hpp"
+#include <string_view>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Arc::Pacman
@@ -54,6 +57,8 @@ private:
     float mTimer;       //<!
     State mState;       //<!
 
+    static std::vector<SpriteHandle> mFont;  //<! Glyph handles, per color
+
 public:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -77,11 +82,17 @@ public:
     ///
     ///////////////////////////////////////////////////////////////////////////
     static void Text(
-        const std::string& text,
+        std::string_view text,
         TextColor color,
         const Vec2i& position
     );
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Register every glyph of the font in the sprite registry
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void RegisterFont(void);
+
 private:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -6,7 +6,6 @@
 #include "games/SNAKE/Assets.hpp"
 #include <iostream>
 #include <cstdlib>
-#include <ctime>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Arc
@@ -30,10 +29,6 @@ Snake::Snake(void)
     mSnakeParts.push_back(Vec2i{mPosition.x - 2, mPosition.y});
     mSnakeParts.push_back(Vec2i{mPosition.x - 4, mPosition.y});
     mSnakeParts.push_back(Vec2i{mPosition.x - 6, mPosition.y});
-
-    std::srand(static_cast<unsigned int>(std::time(nullptr)));
-
-    respawnApple();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -56,10 +51,42 @@ void Snake::respawnApple(void)
     mApplePosition = {x, y};
 }
 
+///////////////////////////////////////////////////////////////////////////////
+static const int LTRS_OFFSET_Y = 8;
+static const char LTRS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ!@..0123456789/-\"";
+static const int LTRS_COUNT = sizeof(LTRS) - 1;
+static const int LTRS_ROW_SIZE = 15;
+static const Color LTS_COLORS[] = {
+    Color{224, 221, 255}, Color{255, 0, 0}, Color{252, 181, 255},
+    Color{0, 255, 255}, Color{248, 187, 85}, Color{250, 185, 176},
+    Color{255, 255, 0}
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 void Snake::BeginPlay(void)
 {
+    int colors = static_cast<int>(TextColor::TEXT_YELLOW) + 1;
+
+    mSprites = API::RegisterSprites(SPRITES);
+    mFont.clear();
+    for (int color = 0; color < colors; color++) {
+        for (int index = 0; index < LTRS_COUNT; index++) {
+            int row = index / LTRS_ROW_SIZE + color * 4;
+            int col = index % LTRS_ROW_SIZE;
+
+            mFont.push_back(API::RegisterSprite(IGameModule::Asset(
+                {col, LTRS_OFFSET_Y + row},
+                std::string(1, LTRS[index]),
+                LTS_COLORS[color]
+            )));
+        }
+    }
+
     API::PushEvent(API::Event::GRAPHICS, API::Event::GridSize({31, 28}));
+
+    std::srand(API::NextRandomSeed());
+
+    respawnApple();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -68,23 +95,16 @@ void Snake::EndPlay(void)
 
 ///////////////////////////////////////////////////////////////////////////////
 void Snake::Text(
-    const std::string& text,
+    std::string_view text,
     Snake::TextColor color,
     const Vec2i& position
 )
 {
-    static const int LTRS_OFFSET_Y = 8;
-    static const char LTRS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ!@..0123456789/-\"";
-    static const int LTRS_ROW_SIZE = 15;
-    static const Color LTS_COLORS[] = {
-        Color{224, 221, 255}, Color{255, 0, 0}, Color{252, 181, 255},
-        Color{0, 255, 255}, Color{248, 187, 85}, Color{250, 185, 176},
-        Color{255, 255, 0}
-    };
+    int offset = static_cast<int>(color) * LTRS_COUNT;
 
     for (size_t i = 0; i < text.size(); i++) {
         int index = -1;
-        for (size_t j = 0; j < sizeof(LTRS); j++) {
+        for (int j = 0; j < LTRS_COUNT; j++) {
             if (text[i] == LTRS[j]) {
                 index = j;
                 break;
@@ -95,16 +115,10 @@ void Snake::Text(
             continue;
         }
 
-        int row = index / LTRS_ROW_SIZE + static_cast<int>(color) * 4;
-        int col = index % LTRS_ROW_SIZE;
-
-        IGameModule::Asset sprite(
-            {col, LTRS_OFFSET_Y + row},
-            std::string(1, text[i]),
-            LTS_COLORS[static_cast<int>(color)]
+        API::Draw(
+            mFont[offset + index],
+            position + Vec2i{static_cast<int>(i), 0}
         );
-
-        API::Draw(sprite, position + Vec2i{static_cast<int>(i), 0});
     }
 }
 
@@ -252,7 +266,7 @@ void Snake::drawSpritesSnake(void)
                 }
             }
         }
-        API::Draw(SPRITES[sprite], mSnakeParts[i]);
+        API::Draw(mSprites[sprite], mSnakeParts[i]);
     }
 }
 
@@ -308,7 +322,10 @@ void Snake::drawScore(void)
     Text("SCORE", TextColor::TEXT_WHITE, Vec2i{2, 2});
     Text("BEST SCORE", TextColor::TEXT_WHITE, Vec2i{15, 2});
     Text(std::to_string(mScore), TextColor::TEXT_WHITE, Vec2i{8, 2});
-    Text(std::to_string(mBestScore), TextColor::TEXT_WHITE, Vec2i{26, 2});
+    Text(
+        std::to_string(mBestScore > mScore ? mBestScore : mScore),
+        TextColor::TEXT_WHITE, Vec2i{26, 2}
+    );
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -316,23 +333,24 @@ void Snake::Tick(float deltaSeconds)
 {
     mAccumulatedTime += deltaSeconds;
 
-    while (auto event = API::PollEvent(API::Event::GAME)) {
-        if (auto key = event->GetIf<API::Event::KeyPressed>()) {
-            handleKeyPressed(key->code);
-        } else if (auto best = event->GetIf<API::Event::BestScore>()) {
-            mBestScore = best->score > mScore ? best->score : mScore;
+    API::DispatchEvents(API::Event::GAME,
+        [this](const API::Event::KeyPressed& key) {
+            handleKeyPressed(key.code);
+        },
+        [this](const API::Event::BestScore& best) {
+            mBestScore = best.score;
         }
-    }
+    );
 
     if (!mGameOver) {
         for (size_t y = 4; y < 28; y += 2) {
             for (size_t x = 0; x < 31; x += 2) {
-                API::Draw(SPRITES[EMPTY], Vec2i(x, y));
+                API::Draw(mSprites[EMPTY], Vec2i(x, y));
             }
         }
         if (mIngame) {
             moveSnake();
-            API::Draw(SPRITES[APPLE], mApplePosition);
+            API::Draw(mSprites[APPLE], mApplePosition);
         } else {
             Text("PRESS SPACE TO START", TextColor::TEXT_WHITE, Vec2i{5, 25});
         }
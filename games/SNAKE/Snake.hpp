@@ -9,7 +9,10 @@
 #include "Arcade/interfaces/IGameModule.hpp"
 #include "Arcade/utils/Vec2.hpp"
 #include "Arcade/enums/Inputs.hpp"
+#include "Arcade/core/SpriteRegistry.hpp"
 #include <deque>
+#include <string_view>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace Arc
@@ -37,6 +40,8 @@ private:
     bool mIngame;                   //<!
     int mBestScore;                 //<!
     std::deque<Vec2i> mSnakeParts;  //<!
+    std::vector<SpriteHandle> mSprites; //<! Handles of SPRITES
+    std::vector<SpriteHandle> mFont;    //<! Glyph handles, per color
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -76,7 +81,7 @@ private:
     ///
     ///////////////////////////////////////////////////////////////////////////
     void Text(
-        const std::string& text,
+        std::string_view text,
         TextColor color,
         const Vec2i& position
     );